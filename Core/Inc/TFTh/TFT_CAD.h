@@ -19,6 +19,70 @@ extern "C"
         uint16_t y; // 点的 Y 坐标 (行)
     } TFT_Point;
 
+    /**
+     * @brief  矩形 (左上角 + 尺寸)
+     */
+    typedef struct
+    {
+        uint16_t x;      // 左上角列坐标
+        uint16_t y;      // 左上角行坐标
+        uint16_t width;  // 宽度
+        uint16_t height; // 高度
+    } TFT_Rect;
+
+    /**
+     * @brief  多边形填充规则
+     */
+    typedef enum
+    {
+        TFT_FILL_EVEN_ODD = 0, // 奇偶规则: 穿越边数为奇数的区域被填充
+        TFT_FILL_NONZERO = 1   // 非零环绕规则: 环绕数不为 0 的区域被填充
+    } TFT_Fill_Rule;
+
+    /**
+     * @brief  粗线折线的拐角连接方式
+     */
+    typedef enum
+    {
+        TFT_JOIN_MITER = 0, // 尖角 (过长时自动退化为斜角)
+        TFT_JOIN_ROUND = 1, // 圆角
+        TFT_JOIN_BEVEL = 2  // 斜角
+    } TFT_Line_Join;
+
+    /**
+     * @brief  粗线端点样式
+     */
+    typedef enum
+    {
+        TFT_CAP_BUTT = 0, // 平头，线段恰好在端点处结束
+        TFT_CAP_ROUND = 1 // 圆头，端点处补半圆
+    } TFT_Line_Cap;
+
+    /**
+     * @brief  线性渐变方向
+     */
+    typedef enum
+    {
+        TFT_GRADIENT_HORIZONTAL = 0, // 从左到右
+        TFT_GRADIENT_VERTICAL = 1    // 从上到下
+    } TFT_Gradient_Direction;
+
+    /**
+     * @brief  水平线段 (span) 汇集器
+     * @note   填充类函数把逐行生成的水平线段交给汇集器输出。连续多行起止列相同的线段
+     *         (或同一行首尾相接的线段) 会被合并成一个矩形，只需一次地址窗口设置和一次连续传输。
+     *         使用顺序: TFT_Span_Begin -> 若干次 TFT_Span_Add -> TFT_Span_End。
+     */
+    typedef struct
+    {
+        TFT_HandleTypeDef *htft; // 目标屏幕句柄
+        uint16_t color;          // 填充颜色 (RGB565格式)
+        int16_t x;               // 暂存矩形左上角列坐标
+        int16_t y;               // 暂存矩形左上角行坐标
+        uint16_t width;          // 暂存矩形宽度 (0 表示没有暂存内容)
+        uint16_t height;         // 暂存矩形高度
+    } TFT_Span_Sink;
+
     // TFT 绘图函数声明
 
     /**
@@ -231,7 +295,7 @@ extern "C"
     void TFT_Fill_Ellipse(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint16_t radiusX, uint16_t radiusY, uint16_t color);
 
     /**
-     * @brief  绘制二阶贝塞尔曲线
+     * @brief  绘制二阶贝塞尔曲线 (整数前向差分，不使用浮点运算)
      * @param  htft TFT句柄指针
      * @param  x0, y0 起始点坐标
      * @param  x1, y1 控制点坐标
@@ -254,16 +318,85 @@ extern "C"
     void TFT_Draw_Polygon(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_t numPoints, uint16_t color);
 
     /**
-     * @brief  填充简单多边形（不处理复杂情况如自交）
+     * @brief  填充多边形 (奇偶规则)
      * @param  htft TFT句柄指针
      * @param  points 多边形顶点坐标数组
      * @param  numPoints 顶点数量
      * @param  color 填充颜色
      * @retval 无
-     * @note   使用水平扫描线算法，仅适用于简单多边形
+     * @note   等同于 TFT_Fill_Polygon_Rule(..., TFT_FILL_EVEN_ODD, color)，支持凹多边形和自交多边形
      */
     void TFT_Fill_Polygon(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_t numPoints, uint16_t color);
 
+    /**
+     * @brief  按指定填充规则填充多边形 (边表 + 活动边表扫描线算法)
+     * @param  htft TFT句柄指针
+     * @param  points 多边形顶点坐标数组
+     * @param  numPoints 顶点数量
+     * @param  rule 填充规则 (TFT_FILL_EVEN_ODD / TFT_FILL_NONZERO)
+     * @param  color 填充颜色
+     * @retval 无
+     * @note   边表按起始行排序，活动边的 X 坐标以 Q16 定点逐行递增，交点数量不受限制。
+     *         边表需要 numPoints * 20 字节左右的堆内存 (malloc)，分配失败时不绘制。
+     */
+    void TFT_Fill_Polygon_Rule(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_t numPoints, TFT_Fill_Rule rule, uint16_t color);
+
+    /**
+     * @brief  开始一组水平线段输出
+     * @param  sink  汇集器
+     * @param  htft  TFT句柄指针
+     * @param  color 填充颜色 (RGB565格式)
+     * @retval 无
+     */
+    void TFT_Span_Begin(TFT_Span_Sink *sink, TFT_HandleTypeDef *htft, uint16_t color);
+
+    /**
+     * @brief  输出一条水平线段
+     * @param  sink  汇集器
+     * @param  x     起始列坐标 (可以为负，超出左边界的部分被裁掉)
+     * @param  y     行坐标 (为负时整条线段被丢弃)
+     * @param  width 线段宽度 (像素)
+     * @retval 无
+     * @note   与暂存矩形能合并时只更新暂存矩形，否则先把暂存矩形发送到屏幕。
+     */
+    void TFT_Span_Add(TFT_Span_Sink *sink, int16_t x, int16_t y, int16_t width);
+
+    /**
+     * @brief  结束一组水平线段输出，发送剩余的暂存矩形
+     * @param  sink 汇集器
+     * @retval 无
+     */
+    void TFT_Span_End(TFT_Span_Sink *sink);
+
+    /**
+     * @brief  绘制粗直线
+     * @param  htft TFT句柄指针
+     * @param  x1, y1 起点坐标
+     * @param  x2, y2 终点坐标
+     * @param  width 线宽 (像素)，1 时等同于 TFT_Draw_Line
+     * @param  cap 端点样式 (TFT_CAP_BUTT / TFT_CAP_ROUND)
+     * @param  color 线条颜色
+     * @retval 无
+     */
+    void TFT_Draw_Thick_Line(TFT_HandleTypeDef *htft, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                             uint16_t width, TFT_Line_Cap cap, uint16_t color);
+
+    /**
+     * @brief  绘制粗折线
+     * @param  htft TFT句柄指针
+     * @param  points 折线顶点坐标数组
+     * @param  numPoints 顶点数量
+     * @param  width 线宽 (像素)，1 时逐段调用 TFT_Draw_Line
+     * @param  join 拐角连接方式 (TFT_JOIN_MITER / TFT_JOIN_ROUND / TFT_JOIN_BEVEL)
+     * @param  cap 端点样式 (TFT_CAP_BUTT / TFT_CAP_ROUND)
+     * @param  color 线条颜色
+     * @retval 无
+     * @note   各段、拐角和端点的轮廓放入同一张边表，按非零规则一次扫描转换，
+     *         重叠部分不会重复发送，线宽只增加每行线段的长度。
+     */
+    void TFT_Draw_Polyline(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_t numPoints,
+                           uint16_t width, TFT_Line_Join join, TFT_Line_Cap cap, uint16_t color);
+
     /**
      * @brief  绘制圆弧
      * @param  htft TFT句柄指针
@@ -273,10 +406,157 @@ extern "C"
      * @param  endAngle 结束角度(0-360度)
      * @param  color 圆弧颜色
      * @retval 无
+     * @note   角度从 X 轴正方向起顺时针增大。使用中点画圆法逐点判断角度，不使用浮点运算。
+     *         0 与 360 这类取模后相等的参数表示整圆。
      */
     void TFT_Draw_Arc(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint8_t radius,
                       uint16_t startAngle, uint16_t endAngle, uint16_t color);
 
+    /**
+     * @brief  填充圆环扇区 (圆环段)
+     * @param  htft TFT句柄指针
+     * @param  centerX, centerY 圆心坐标
+     * @param  outerRadius 外半径
+     * @param  innerRadius 内半径 (0 表示实心扇形)
+     * @param  startAngle 起始角度(0-360度)
+     * @param  endAngle 结束角度(0-360度)
+     * @param  color 填充颜色
+     * @retval 无
+     * @note   角度约定与 TFT_Draw_Arc 相同，起止角度相同表示整个圆环。
+     *         逐行按整数半平面判断求出列范围，直接以水平线段输出，不使用浮点运算。
+     *         起始边上的像素属于扇区，结束边上的不属于，相邻扇区拼接时不重叠。
+     */
+    void TFT_Fill_Arc(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint16_t outerRadius,
+                      uint16_t innerRadius, uint16_t startAngle, uint16_t endAngle, uint16_t color);
+
+    /**
+     * @brief  填充扇形 (饼图切片)
+     * @param  htft TFT句柄指针
+     * @param  centerX, centerY 圆心坐标
+     * @param  radius 半径
+     * @param  startAngle 起始角度(0-360度)
+     * @param  endAngle 结束角度(0-360度)
+     * @param  color 填充颜色
+     * @retval 无
+     */
+    void TFT_Fill_Pie(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint16_t radius,
+                      uint16_t startAngle, uint16_t endAngle, uint16_t color);
+
+    /**
+     * @brief  增量更新圆环仪表
+     * @param  htft TFT句柄指针
+     * @param  centerX, centerY 圆心坐标
+     * @param  outerRadius 外半径
+     * @param  innerRadius 内半径
+     * @param  oldAngle 上一次指示值对应的角度 (度，可超过 360，例如 135 ~ 405)
+     * @param  newAngle 新指示值对应的角度 (度)
+     * @param  color 指示部分颜色
+     * @param  bgColor 轨道 (未指示部分) 颜色
+     * @retval 无
+     * @note   只重绘两次指示值之间的扇区: 增大时用 color 填充 [oldAngle, newAngle)，
+     *         减小时用 bgColor 填充 [newAngle, oldAngle)。首次绘制可先用 TFT_Fill_Arc
+     *         画出整条轨道，再以起始角度作为 oldAngle 调用本函数。
+     */
+    void TFT_Update_Arc_Gauge(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint16_t outerRadius,
+                              uint16_t innerRadius, int16_t oldAngle, int16_t newAngle, uint16_t color, uint16_t bgColor);
+
+    /**
+     * @brief  批量填充矩形
+     * @param  htft TFT句柄指针
+     * @param  rects 矩形数组
+     * @param  colors 颜色数组 (与 rects 一一对应)
+     * @param  count 矩形数量
+     * @retval 无
+     * @note   适合条形图、进度条、网格背景等一次绘制多个矩形的场合。每 32 个矩形一组，同色矩形在
+     *         不改变重叠部分先后顺序的前提下集中发送，复用预填充的纯色半区；换色时只有新颜色的预填充
+     *         与上一块 DMA 传输并行，设置窗口仍需等待上一块传输完成。最后一块传输不等待完成。不使用堆内存。
+     */
+    void TFT_Fill_Rects(TFT_HandleTypeDef *htft, const TFT_Rect rects[], const uint16_t colors[], uint16_t count);
+
+    /**
+     * @brief  批量绘制矩形边框
+     * @param  htft TFT句柄指针
+     * @param  rects 矩形数组
+     * @param  colors 颜色数组 (与 rects 一一对应)
+     * @param  count 矩形数量
+     * @retval 无
+     * @note   每个边框拆成四条纯色矩形，在栈上攒成一组后按 TFT_Fill_Rects 的方式发送。
+     */
+    void TFT_Draw_Rects(TFT_HandleTypeDef *htft, const TFT_Rect rects[], const uint16_t colors[], uint16_t count);
+
+    /**
+     * @brief  移动纯色矩形 (只重绘变化的部分)
+     * @param  htft TFT句柄指针
+     * @param  oldRect 原来的位置和尺寸 (尺寸为 0 表示原来没有绘制)
+     * @param  newRect 新的位置和尺寸
+     * @param  color 矩形颜色
+     * @param  bgColor 背景颜色
+     * @retval 无
+     * @note   只填充新旧矩形的对称差: 旧矩形露出的条带用 bgColor，新矩形新覆盖的条带用 color，
+     *         重叠部分不发送。适合每帧移动几个像素的方块、滑块、光标等动画。
+     */
+    void TFT_Move_Rect(TFT_HandleTypeDef *htft, const TFT_Rect *oldRect, const TFT_Rect *newRect, uint16_t color, uint16_t bgColor);
+
+    /**
+     * @brief  填充线性渐变矩形
+     * @param  htft TFT句柄指针
+     * @param  x1, y1 左上角坐标
+     * @param  x2, y2 右下角坐标
+     * @param  color1 起点颜色 (左侧或顶部)
+     * @param  color2 终点颜色 (右侧或底部)
+     * @param  direction 渐变方向 (TFT_GRADIENT_HORIZONTAL / TFT_GRADIENT_VERTICAL)
+     * @param  dither 是否启用 4x4 有序抖动，可消除 RGB565 的色带 (1=启用)
+     * @retval 无
+     * @note   颜色以定点增量逐像素生成并直接写入发送缓冲区，只设置一次窗口，
+     *         总线时间与单色填充基本相同。
+     */
+    void TFT_Fill_Gradient_Rectangle(TFT_HandleTypeDef *htft, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+                                     uint16_t color1, uint16_t color2, TFT_Gradient_Direction direction, uint8_t dither);
+
+    /**
+     * @brief  填充线性渐变圆角矩形
+     * @param  htft TFT句柄指针
+     * @param  x, y 左上角坐标
+     * @param  width, height 宽度和高度
+     * @param  radius 圆角半径
+     * @param  color1 起点颜色 (左侧或顶部)
+     * @param  color2 终点颜色 (右侧或底部)
+     * @param  direction 渐变方向
+     * @param  dither 是否启用 4x4 有序抖动 (1=启用)
+     * @retval 无
+     */
+    void TFT_Fill_Gradient_Rounded_Rectangle(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+                                             uint8_t radius, uint16_t color1, uint16_t color2,
+                                             TFT_Gradient_Direction direction, uint8_t dither);
+
+    /**
+     * @brief  填充径向渐变圆
+     * @param  htft TFT句柄指针
+     * @param  x0, y0 圆心坐标
+     * @param  r 半径 (1 ~ 2047)
+     * @param  centerColor 圆心颜色
+     * @param  edgeColor 边缘颜色
+     * @param  dither 是否启用 4x4 有序抖动 (1=启用)
+     * @retval 无
+     */
+    void TFT_Fill_Radial_Gradient_Circle(TFT_HandleTypeDef *htft, uint16_t x0, uint16_t y0, uint16_t r,
+                                         uint16_t centerColor, uint16_t edgeColor, uint8_t dither);
+
+    /**
+     * @brief  整数正弦 (四分之一周期正弦表)
+     * @param  angle 角度 (度)，可为负数或大于 360
+     * @retval sin(angle) 的 Q15 定点值 (-32767 ~ 32767)
+     * @note   用法示例: x = cx + ((int32_t)r * TFT_Cos(a) >> 15);
+     */
+    int16_t TFT_Sin(int16_t angle);
+
+    /**
+     * @brief  整数余弦 (四分之一周期正弦表)
+     * @param  angle 角度 (度)，可为负数或大于 360
+     * @retval cos(angle) 的 Q15 定点值 (-32767 ~ 32767)
+     */
+    int16_t TFT_Cos(int16_t angle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,124 @@
+/*
+ * @file    TFT_blend.h
+ * @brief   RAM 行带缓冲区中的半透明混合头文件
+ * @details 在一块 RAM 缓冲区 (屏幕上的一个行带) 中半透明地填充矩形、叠加位图和抗锯齿文字，
+ *          完成后用 TFT_Draw_Band (TFT_image.h) 发送到屏幕。不依赖 HAL，可以在 PC 上编译测试 (见 Tools/blend_bench.c)。
+ */
+#ifndef __TFT_BLEND_H
+#define __TFT_BLEND_H
+
+#include "TFTh/font.h" // 包含抗锯齿字体结构体定义
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief  行带缓冲区: 屏幕上一个矩形区域的 RAM 副本
+     * @note   像素为 CPU 字节顺序的 RGB565 (与颜色常量相同)，发送时再转换为屏幕的字节顺序。
+     *         各函数的坐标都是屏幕坐标，只修改落在行带内的部分，因此同一组绘制调用可以逐个行带重复执行。
+     */
+    typedef struct
+    {
+        uint16_t *pixels; // width * height 个像素，逐行存放
+        int16_t x;        // 行带左上角在屏幕上的列坐标
+        int16_t y;        // 行带左上角在屏幕上的行坐标
+        uint16_t width;   // 宽度
+        uint16_t height;  // 高度
+    } TFT_Band;
+
+    /**
+     * @brief  混合两个 RGB565 颜色
+     * @param  fg    前景色
+     * @param  bg    背景色
+     * @param  alpha 前景不透明度 (0 ~ 255)
+     * @retval 混合后的颜色
+     * @note   不透明度量化为 0 ~ 32 级，三个通道用 32 位 SWAR 运算同时计算。
+     */
+    uint16_t TFT_Blend_RGB565(uint16_t fg, uint16_t bg, uint8_t alpha);
+
+    /**
+     * @brief  初始化行带
+     * @param  band   行带
+     * @param  pixels 像素缓冲区 (至少 width * height 个)
+     * @param  x      行带左上角在屏幕上的列坐标
+     * @param  y      行带左上角在屏幕上的行坐标
+     * @param  width  宽度
+     * @param  height 高度
+     * @retval 无
+     * @note   逐个行带绘制时只需修改 band->y，再用 TFT_Band_Fill 或不透明内容覆盖整个行带。
+     */
+    void TFT_Band_Init(TFT_Band *band, uint16_t *pixels, int16_t x, int16_t y, uint16_t width, uint16_t height);
+
+    /**
+     * @brief  用不透明颜色填充整个行带
+     * @param  band  行带
+     * @param  color 颜色
+     * @retval 无
+     */
+    void TFT_Band_Fill(TFT_Band *band, uint16_t color);
+
+    /**
+     * @brief  半透明填充矩形
+     * @param  band   行带
+     * @param  x      矩形左上角列坐标 (屏幕坐标，可为负数)
+     * @param  y      矩形左上角行坐标
+     * @param  width  宽度
+     * @param  height 高度
+     * @param  color  颜色
+     * @param  alpha  不透明度 (0 ~ 255)
+     * @retval 无
+     * @note   前景色只展开一次并预先乘以 alpha，每像素只需一次乘加。
+     */
+    void TFT_Band_Blend_Fill(TFT_Band *band, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color, uint8_t alpha);
+
+    /**
+     * @brief  以固定不透明度叠加 RGB565 位图
+     * @param  band   行带
+     * @param  x      位图左上角列坐标 (屏幕坐标，可为负数)
+     * @param  y      位图左上角行坐标
+     * @param  width  位图宽度
+     * @param  height 位图高度
+     * @param  data   RGB565 位图 (逐行存放，高字节在前，与 TFT_Draw_Bitmap565 相同)
+     * @param  alpha  不透明度 (0 ~ 255)
+     * @retval 无
+     */
+    void TFT_Band_Blend_Bitmap(TFT_Band *band, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t *data, uint8_t alpha);
+
+    /**
+     * @brief  按每像素 4 位不透明度叠加 RGB565 位图
+     * @param  band   行带
+     * @param  x      位图左上角列坐标 (屏幕坐标，可为负数)
+     * @param  y      位图左上角行坐标
+     * @param  width  位图宽度
+     * @param  height 位图高度
+     * @param  data   RGB565 位图 (逐行存放，高字节在前)
+     * @param  alpha  不透明度 (每像素 4 位，0 透明 ~ 15 不透明，逐行存放，每行 (width + 1) / 2 字节，左侧像素在高 4 位)
+     * @retval 无
+     * @note   不透明度为 0 和 15 的像素直接跳过或拷贝，只有边缘像素需要混合运算。
+     */
+    void TFT_Band_Blend_Bitmap_A4(TFT_Band *band, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                                  const uint8_t *data, const uint8_t *alpha);
+
+    /**
+     * @brief  半透明叠加抗锯齿文字
+     * @param  band  行带
+     * @param  x     起始列坐标 (屏幕坐标，可为负数)
+     * @param  y     起始行坐标
+     * @param  str   ASCII 字符串 (超出字体范围的字符显示为第一个字符)
+     * @param  font  抗锯齿字体 (如 &aafont24x12)
+     * @param  color 文字颜色
+     * @param  alpha 整体不透明度 (0 ~ 255，与字模的覆盖率相乘)
+     * @retval 无
+     * @note   与 TFT_Show_AA_String 不同，边缘像素与行带中已有的内容混合，可以显示在渐变、图片等任意背景上。
+     */
+    void TFT_Band_Blend_AA_String(TFT_Band *band, int16_t x, int16_t y, const uint8_t *str, const AAFont *font,
+                                  uint16_t color, uint8_t alpha);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -53,6 +53,54 @@
 
 #define TFT_BUFFER_SIZE 4096 // 2048 字节 (1024 像素, RGB565 格式)
 
+/**
+ * @brief 字符串一次连续绘制的最大字符数
+ *
+ * 字符串按此长度分段，每段只设置一次地址窗口，逐扫描线跨所有字符连续输出。
+ * 每个字符占用 12 字节的栈空间。
+ */
+#define TFT_TEXT_RUN_MAX 32
+
+/**
+ * @brief 屏幕最大宽度 (像素，取各显示方向中较大的一边)
+ *
+ * 比例字体按此宽度在栈上分配一行位掩码 ((TFT_MAX_WIDTH + 7) / 8 字节)，超出部分不绘制。
+ */
+#define TFT_MAX_WIDTH 320
+
+/**
+ * @brief 字模缓存的内存预算 (字节)，设为 0 关闭缓存
+ *
+ * 缓存保存按 (字库, 字符, 前景色, 背景色) 展开好的 RGB565 像素，最近最少使用的被淘汰。
+ * 每帧以相同颜色重绘的状态文字命中缓存后不再逐位展开字模。
+ */
+#define TFT_GLYPH_CACHE_SIZE 2048
+
+/**
+ * @brief 每个字模缓存槽的大小 (字节)
+ *
+ * 槽数 = TFT_GLYPH_CACHE_SIZE / TFT_GLYPH_CACHE_SLOT_SIZE。宽x高x2 超过槽大小的字模不缓存，
+ * 默认 256 可容纳 8x6、12x6、16x8 字模；需要缓存 24x12 字模时改为 576。
+ */
+#define TFT_GLYPH_CACHE_SLOT_SIZE 256
+
+/**
+ * @brief 文本框 (TFT_TextField) 最多记录的字符数，超出部分不显示
+ */
+#define TFT_TEXT_FIELD_MAX 24
+
+/**
+ * @brief JPEG 解码器的输入缓冲区大小 (字节)
+ *
+ * 解码器每次通过输入函数读取这么多字节的压缩数据，包含在 TFT_JPEG_Decoder 中。
+ */
+#define TFT_JPEG_INPUT_SIZE 256
+
+/**
+ * @brief 每个精灵场景 (TFT_Sprite_Scene) 最多的精灵数
+ */
+#define TFT_SPRITE_MAX 8
+
 /**
  * @brief 定义最大支持的 TFT 设备数量
  */
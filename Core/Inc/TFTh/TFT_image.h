@@ -0,0 +1,131 @@
+/*
+ * @file    TFT_image.h
+ * @brief   TFT屏幕图片显示函数头文件
+ * @details 定义了TFT屏幕图片绘制函数接口
+ */
+#ifndef __TFT_IMAGE_H
+#define __TFT_IMAGE_H
+
+#include "main.h"
+#include "TFTh/TFT_io.h" // 包含TFT_io.h以获取TFT_HandleTypeDef结构体定义
+#include "TFTh/font.h"   // 包含图片结构体定义
+#include "TFTh/TFT_jpeg.h" // JPEG 解码器
+#include "TFTh/TFT_blend.h" // 行带缓冲区
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief  绘制单色图片
+     * @param  htft TFT句柄指针
+     * @param  x          左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+     * @param  y          左上角行坐标 (可为负数)
+     * @param  image      图片 (列行式: 每 8 行为一页，页内每列 1 字节，LSB 在上，如 bilibiliImg)
+     * @param  color      点亮像素的颜色
+     * @param  back_color 背景颜色
+     * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+     * @retval 无
+     * @note   不透明时整幅图片 (剪裁后) 只设置一次按列填充的地址窗口，图片字节按存放顺序查表展开后直接写入发送缓冲区；
+     *         透明时每行连续的点亮像素作为一条线段写入，背景保持屏幕原有内容。
+     *         只绘制落在剪裁矩形 (TFT_Set_Clip) 内的部分。
+     */
+    void TFT_Draw_Image_1bpp(TFT_HandleTypeDef *htft, int16_t x, int16_t y, const Image *image, uint16_t color, uint16_t back_color, uint8_t mode);
+
+    /**
+     * @brief  绘制 RGB565 彩色位图
+     * @param  htft TFT句柄指针
+     * @param  x      左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+     * @param  y      左上角行坐标 (可为负数)
+     * @param  width  位图宽度
+     * @param  height 位图高度
+     * @param  data   像素数据 (逐行存放，每像素 2 字节，高字节在前，即屏幕接收的字节顺序)
+     * @retval 无
+     * @note   数据不经过发送缓冲区，DMA 直接以 data (可以在 Flash 中) 为源地址发送，
+     *         每次最多 65534 字节。位图整行可见时整块连续发送，左右被剪裁时逐行发送可见部分。
+     *         最后一次传输不等待完成，data 在传输结束前必须保持有效 (Flash 中的常量数据总是有效的)。
+     */
+    void TFT_Draw_Bitmap565(TFT_HandleTypeDef *htft, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t *data);
+
+    /**
+     * @brief  缩放和旋转绘制单色图片
+     * @param  htft       TFT句柄指针
+     * @param  x          左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+     * @param  y          左上角行坐标 (可为负数)
+     * @param  image      图片 (列行式，同 TFT_Draw_Image_1bpp)
+     * @param  width      屏幕上的宽度 (旋转后)，与 height 之一为 0 时使用原尺寸
+     * @param  height     屏幕上的高度 (旋转后)
+     * @param  rotation   顺时针旋转 (0: 0°, 1: 90°, 2: 180°, 3: 270°)
+     * @param  color      点亮像素的颜色
+     * @param  back_color 背景颜色
+     * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+     * @retval 无
+     * @note   最近邻缩放 (定点步进，不用除法)。90°/270° 由屏幕按列填充的地址顺序完成旋转。
+     *         同一份图片数据可以显示为不同大小和方向，不需要在 Flash 中保存多份。
+     */
+    void TFT_Draw_Image_1bpp_Transform(TFT_HandleTypeDef *htft, int16_t x, int16_t y, const Image *image,
+                                       uint16_t width, uint16_t height, uint8_t rotation,
+                                       uint16_t color, uint16_t back_color, uint8_t mode);
+
+    /**
+     * @brief  缩放和旋转绘制 RGB565 彩色位图
+     * @param  htft       TFT句柄指针
+     * @param  x          左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+     * @param  y          左上角行坐标 (可为负数)
+     * @param  src_width  位图宽度
+     * @param  src_height 位图高度
+     * @param  data       像素数据 (同 TFT_Draw_Bitmap565)
+     * @param  width      屏幕上的宽度 (旋转后)，与 height 之一为 0 时使用原尺寸
+     * @param  height     屏幕上的高度 (旋转后)
+     * @param  rotation   顺时针旋转 (0: 0°, 1: 90°, 2: 180°, 3: 270°)
+     * @retval 无
+     * @note   最近邻缩放，按源图片的行顺序读取，像素直接写入发送缓冲区。
+     *         90°/270° 使用按列填充的窗口 (翻转 MADCTL 的 MV 位)，由屏幕的地址顺序完成旋转。
+     */
+    void TFT_Draw_Bitmap565_Transform(TFT_HandleTypeDef *htft, int16_t x, int16_t y, uint16_t src_width, uint16_t src_height,
+                                      const uint8_t *data, uint16_t width, uint16_t height, uint8_t rotation);
+
+    /**
+     * @brief  绘制 QOI 风格压缩的 RGB565 图片
+     * @param  htft  TFT句柄指针
+     * @param  x     左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+     * @param  y     左上角行坐标 (可为负数)
+     * @param  image 压缩图片 (由 Tools/gen_packed_image.py 生成)
+     * @retval 无
+     * @note   只设置一次地址窗口，边解码边把像素直接写入发送缓冲区的当前半区，
+     *         DMA 发送一个半区的同时解码下一个半区。解码状态约 140 字节，不需要整幅图片的缓冲区。
+     */
+    void TFT_Draw_Packed_Image(TFT_HandleTypeDef *htft, int16_t x, int16_t y, const PackedImage *image);
+
+    /**
+     * @brief  解码并绘制基线 JPEG 图片
+     * @param  htft  TFT句柄指针
+     * @param  x     左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+     * @param  y     左上角行坐标 (可为负数)
+     * @param  data  JPEG 文件数据 (可以在 Flash 中)
+     * @param  size  数据字节数
+     * @param  scale 缩小比例 (0: 1/1, 1: 1/2, 2: 1/4, 3: 1/8)，用于显示比屏幕大的照片
+     * @retval 解码结果 (TFT_JPEG_OK 或错误原因)
+     * @note   支持基线顺序编码、灰度或 YCbCr 4:4:4/4:2:2/4:2:0，不支持渐进式 JPEG。
+     *         解码器工作内存约 3 KB (绘制期间 malloc)，不需要整幅图片的缓冲区。
+     *         每个 MCU 解码后设置一次地址窗口写入，DMA 发送当前块的同时解码下一个块。
+     */
+    TFT_JPEG_Result TFT_Draw_JPEG(TFT_HandleTypeDef *htft, int16_t x, int16_t y, const uint8_t *data, uint32_t size, uint8_t scale);
+
+    /**
+     * @brief  把行带缓冲区发送到屏幕上它所在的位置
+     * @param  htft TFT句柄指针
+     * @param  band 行带 (见 TFT_blend.h)
+     * @retval 无
+     * @note   只设置一次窗口，像素转换为屏幕字节顺序后写入发送缓冲区，DMA 发送一个半区时转换下一个半区。
+     *         返回时行带已全部拷贝，可以立即绘制下一个行带。只绘制剪裁矩形内的部分。
+     */
+    void TFT_Draw_Band(TFT_HandleTypeDef *htft, const TFT_Band *band);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
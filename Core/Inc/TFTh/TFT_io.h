@@ -34,7 +34,10 @@ extern "C"
 
         uint8_t *tx_buffer;          // 发送缓冲区
         uint16_t buffer_size;        // 缓冲区大小
-        uint16_t buffer_write_index; // 当前缓冲区写入位置索引
+        uint16_t buffer_write_index; // 当前缓冲区写入位置索引 (相对当前半区)
+        uint8_t buffer_half;         // DMA 模式下当前写入的半区 (0/1)
+        uint8_t prepared_color_valid; // 当前半区是否已填满 prepared_color (纯色重复发送用)
+        uint16_t prepared_color;      // 当前半区预先填充的纯色
 
         uint8_t is_dma_enabled;                  // DMA使能标志
         volatile uint8_t is_dma_transfer_active; // DMA传输忙标志
@@ -42,6 +45,13 @@ extern "C"
         uint8_t display_direction; // 显示方向
         uint8_t x_offset;          // X偏移量
         uint8_t y_offset;          // Y偏移量
+        uint8_t madctl;            // 当前方向的 MADCTL 值 (由屏幕初始化时写入)
+        uint8_t madctl_transposed; // 屏幕中的 MADCTL 是否为行列交换后的值 (下次设置普通窗口时恢复)
+
+        uint16_t clip_x0; // 剪裁矩形左边界
+        uint16_t clip_y0; // 剪裁矩形上边界
+        uint16_t clip_x1; // 剪裁矩形右边界 (不包含)
+        uint16_t clip_y1; // 剪裁矩形下边界 (不包含)
     } TFT_HandleTypeDef;
 
     //----------------- TFT 控制引脚函数声明 (硬件抽象) -----------------
@@ -119,6 +129,26 @@ extern "C"
                             uint8_t display_direction,
                             uint8_t x_offset, uint8_t y_offset);
 
+    /**
+     * @brief  设置剪裁矩形
+     * @param  htft TFT句柄指针
+     * @param  x0 左边界
+     * @param  y0 上边界
+     * @param  x1 右边界 (不包含)
+     * @param  y1 下边界 (不包含)
+     * @retval 无
+     * @note   图片等块传输函数只绘制落在剪裁矩形内的部分 (可用来限制在屏幕范围或某个区域内)。
+     *         默认不剪裁 (0, 0, 0xFFFF, 0xFFFF)。
+     */
+    void TFT_Set_Clip(TFT_HandleTypeDef *htft, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+
+    /**
+     * @brief  取消剪裁矩形
+     * @param  htft TFT句柄指针
+     * @retval 无
+     */
+    void TFT_Reset_Clip(TFT_HandleTypeDef *htft);
+
     /**
      * @brief  初始化 TFT IO 层
      * @param  htft TFT句柄指针
@@ -143,9 +173,74 @@ extern "C"
      * @param  data 要写入的 16 位数据
      * @retval 无
      * @note   数据以大端模式写入。若缓冲区满则自动刷新 (非阻塞)。
+     *         DMA 模式下缓冲区分为两个半区交替使用，刷新后的写入不会覆盖正在发送的数据。
      */
     void TFT_Buffer_Write16(TFT_HandleTypeDef *htft, uint16_t data);
 
+    /**
+     * @brief  申请直接写入发送缓冲区的空间
+     * @param  htft TFT句柄指针
+     * @param  length 输出可连续写入的字节数 (偶数，至少 2)
+     * @retval 可写入位置的指针，失败时返回 NULL
+     * @note   适合逐像素生成颜色的场合 (如渐变): 直接把大端 RGB565 数据写到返回地址，
+     *         然后调用 TFT_Buffer_Commit，省去每个像素一次函数调用。
+     */
+    uint8_t *TFT_Buffer_Reserve(TFT_HandleTypeDef *htft, uint16_t *length);
+
+    /**
+     * @brief  提交通过 TFT_Buffer_Reserve 写入的数据
+     * @param  htft TFT句柄指针
+     * @param  length 实际写入的字节数
+     * @retval 无
+     * @note   当前半区写满时自动启动非阻塞发送。
+     */
+    void TFT_Buffer_Commit(TFT_HandleTypeDef *htft, uint16_t length);
+
+    /**
+     * @brief  预先把纯色像素填满空闲的半区
+     * @param  htft TFT句柄指针
+     * @param  color 颜色 (RGB565格式)
+     * @retval 无
+     * @note   可在上一次 DMA 传输进行时调用，使下一块纯色数据的准备与传输并行。
+     */
+    void TFT_Buffer_Prepare_Color(TFT_HandleTypeDef *htft, uint16_t color);
+
+    /**
+     * @brief  向当前窗口连续发送纯色像素
+     * @param  htft TFT句柄指针
+     * @param  color 颜色 (RGB565格式)
+     * @param  count 像素数量
+     * @retval 无
+     * @note   预填充的半区被重复交给 DMA 发送。不等待最后一次传输完成，
+     *         后续的命令、窗口设置或数据写入会自动等待。
+     */
+    void TFT_Write_Color_Repeat(TFT_HandleTypeDef *htft, uint16_t color, uint32_t count);
+
+    /**
+     * @brief  按两种颜色把 1 位像素展开为大端 RGB565 数据
+     * @param  bits       像素位，bit0 对应第一个像素
+     * @param  count      像素个数 (不超过 32)
+     * @param  color      位为 1 的像素颜色
+     * @param  back_color 位为 0 的像素颜色
+     * @param  dst        输出位置 (count x 2 字节)
+     * @retval 输出结束的位置
+     * @note   每 4 位查一次展开表，一次拷贝 4 个像素。展开表按颜色缓存，颜色不变时不重新生成。
+     *         适合字模、单色图片等 1 位数据。
+     */
+    uint8_t *TFT_Expand_Mono(uint32_t bits, uint8_t count, uint16_t color, uint16_t back_color, uint8_t *dst);
+
+    /**
+     * @brief  按两种颜色把 1 位像素展开后写入发送缓冲区
+     * @param  htft       TFT句柄指针
+     * @param  bits       像素位，bit0 对应第一个像素
+     * @param  count      像素个数 (不超过 32)
+     * @param  color      位为 1 的像素颜色
+     * @param  back_color 位为 0 的像素颜色
+     * @retval 无
+     * @note   直接展开到发送缓冲区，当前半区剩余空间不足时分两次写入。
+     */
+    void TFT_Buffer_Write_Mono(TFT_HandleTypeDef *htft, uint32_t bits, uint8_t count, uint16_t color, uint16_t back_color);
+
     /**
      * @brief  将发送缓冲区中剩余的数据发送到 TFT
      * @param  htft TFT句柄指针
@@ -200,6 +295,20 @@ extern "C"
      */
     void TFT_Set_Address(TFT_HandleTypeDef *htft, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end);
 
+    /**
+     * @brief  设置按列填充的 TFT 显示窗口区域
+     * @param  htft TFT句柄指针
+     * @param  x_start 列起始坐标 (0-based)
+     * @param  y_start 行起始坐标 (0-based)
+     * @param  x_end   列结束坐标 (0-based, inclusive)
+     * @param  y_end   行结束坐标 (0-based, inclusive)
+     * @retval 无
+     * @note   窗口坐标与 TFT_Set_Address 相同，但临时翻转 MADCTL 的 MV 位，
+     *         后续像素数据先从上到下填满一列，再移到右边一列。适合按列存放的字模等数据。
+     *         MADCTL 在下一次调用 TFT_Set_Address 时自动恢复。
+     */
+    void TFT_Set_Address_Transposed(TFT_HandleTypeDef *htft, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end);
+
     //----------------- 平台相关的 SPI 传输函数声明 (内部使用) -----------------
 
     /**
@@ -0,0 +1,150 @@
+/*
+ * @file    TFT_jpeg.h
+ * @brief   小内存基线 JPEG 解码器头文件
+ * @details 逐个 MCU 解码基线 (顺序、哈夫曼编码) JPEG，支持 1/2、1/4、1/8 缩小解码。
+ *          不依赖 HAL，可以在 PC 上编译测试 (见 Tools/jpeg_bench.c)。
+ */
+#ifndef __TFT_JPEG_H
+#define __TFT_JPEG_H
+
+#include "TFTh/TFT_config.h" // 获取 TFT_JPEG_INPUT_SIZE
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief  解码结果
+     */
+    typedef enum
+    {
+        TFT_JPEG_OK = 0,          // 成功
+        TFT_JPEG_ERR_INPUT,       // 数据提前结束
+        TFT_JPEG_ERR_FORMAT,      // 不是 JPEG 或数据损坏
+        TFT_JPEG_ERR_UNSUPPORTED, // 不支持的格式 (渐进式、算术编码、12 位精度、特殊采样比例等)
+        TFT_JPEG_ERR_MEMORY       // 工作内存分配失败
+    } TFT_JPEG_Result;
+
+    /**
+     * @brief  输入函数: 读取最多 length 字节到 buffer
+     * @retval 实际读取的字节数，0 表示数据结束
+     */
+    typedef uint16_t (*TFT_JPEG_Input)(void *context, uint8_t *buffer, uint16_t length);
+
+    /**
+     * @brief  输出函数: 一个解码好的块 (一个 MCU，已按缩小比例缩小，并去掉了超出图片边界的部分)
+     * @param  context 用户上下文
+     * @param  x       块在 (缩小后) 图片中的列坐标
+     * @param  y       块在 (缩小后) 图片中的行坐标
+     * @param  width   块宽度
+     * @param  height  块高度
+     * @param  pixels  逐行存放的 RGB565 像素，每像素 2 字节，高字节在前 (即屏幕接收的字节顺序)
+     */
+    typedef void (*TFT_JPEG_Output)(void *context, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pixels);
+
+    /**
+     * @brief  哈夫曼表 (规范哈夫曼码)
+     */
+    typedef struct
+    {
+        int32_t max_code[17];  // 各码长的最大码值，-1 表示没有该长度的码
+        uint16_t min_code[17]; // 各码长的最小码值
+        uint8_t offset[17];    // 各码长第一个码在 values 中的位置
+        uint8_t values[162];   // 符号 (按码值排序)
+    } TFT_JPEG_Huffman;
+
+    /**
+     * @brief  颜色分量
+     */
+    typedef struct
+    {
+        uint8_t id;       // 分量标识
+        uint8_t h;        // 水平采样因子
+        uint8_t v;        // 垂直采样因子
+        uint8_t quant;    // 量化表序号
+        uint8_t dc_table; // DC 哈夫曼表序号
+        uint8_t ac_table; // AC 哈夫曼表序号
+        int16_t dc_pred;  // 上一个块的 DC 值
+    } TFT_JPEG_Component;
+
+    /**
+     * @brief  解码器工作内存 (约 3 KB，可静态分配或 malloc)
+     * @note   使用顺序: TFT_JPEG_Prepare 读取文件头 (得到图片尺寸) -> TFT_JPEG_Decompress 逐个 MCU 解码输出。
+     */
+    typedef struct
+    {
+        TFT_JPEG_Input input;                 // 输入函数
+        void *input_context;                  // 输入函数的上下文
+        uint8_t input_buffer[TFT_JPEG_INPUT_SIZE];
+        uint16_t input_pos;                   // input_buffer 中下一个字节的位置
+        uint16_t input_len;                   // input_buffer 中的有效字节数
+        uint8_t input_end;                    // 输入数据已结束
+
+        uint32_t bit_buffer;                  // 熵编码数据位缓冲 (高位在前)
+        int8_t bit_count;                     // bit_buffer 中的有效位数
+        uint8_t marker;                       // 熵编码数据中遇到的标记 (0 表示没有)
+
+        uint16_t width;                       // 图片宽度
+        uint16_t height;                      // 图片高度
+        uint8_t component_count;              // 颜色分量数 (1: 灰度, 3: YCbCr)
+        uint8_t max_h;                        // 最大水平采样因子
+        uint8_t max_v;                        // 最大垂直采样因子
+        uint16_t restart_interval;            // 复位间隔 (MCU 数，0 表示没有)
+        TFT_JPEG_Component components[3];
+
+        uint8_t quant[4][64];                 // 量化表 (自然顺序)
+        TFT_JPEG_Huffman huffman[4];          // 哈夫曼表: DC0, DC1, AC0, AC1
+
+        int16_t block[64];                    // 当前块的反量化系数 (自然顺序)
+        uint8_t samples[256 + 64 + 64];       // 当前 MCU 各分量的采样值 (Y 最多 16x16，Cb/Cr 各 8x8)
+        uint8_t pixels[16 * 16 * 2];          // 当前 MCU 的 RGB565 像素
+    } TFT_JPEG_Decoder;
+
+    /**
+     * @brief  内存中的 JPEG 数据 (配合 TFT_JPEG_Read_Memory 使用)
+     */
+    typedef struct
+    {
+        const uint8_t *data; // 数据 (可以在 Flash 中)
+        uint32_t size;       // 字节数
+        uint32_t pos;        // 已读取的字节数
+    } TFT_JPEG_Memory;
+
+    /**
+     * @brief  从内存读取 JPEG 数据的输入函数
+     * @param  context TFT_JPEG_Memory 指针
+     * @param  buffer  输出缓冲区
+     * @param  length  最多读取的字节数
+     * @retval 实际读取的字节数
+     */
+    uint16_t TFT_JPEG_Read_Memory(void *context, uint8_t *buffer, uint16_t length);
+
+    /**
+     * @brief  读取 JPEG 文件头，直到扫描数据开始
+     * @param  dec     解码器工作内存
+     * @param  input   输入函数
+     * @param  context 输入函数的上下文
+     * @retval 解码结果，成功后 dec->width / dec->height 为图片尺寸
+     */
+    TFT_JPEG_Result TFT_JPEG_Prepare(TFT_JPEG_Decoder *dec, TFT_JPEG_Input input, void *context);
+
+    /**
+     * @brief  解码图片，每解码一个 MCU 调用一次输出函数
+     * @param  dec     已完成 TFT_JPEG_Prepare 的解码器
+     * @param  scale   缩小比例 (0: 1/1, 1: 1/2, 2: 1/4, 3: 1/8)
+     * @param  output  输出函数
+     * @param  context 输出函数的上下文
+     * @retval 解码结果
+     * @note   缩小解码由系数直接计算每 2x2、4x4、8x8 个像素的平均值 (1/8 只用 DC 系数)，不做完整的反变换。
+     *         4:2:x 图片缩小时色度也按输出尺寸计算，不缩小时色度按最近邻放大。
+     *         缩小后的图片尺寸为 (width + (1 << scale) - 1) >> scale。
+     */
+    TFT_JPEG_Result TFT_JPEG_Decompress(TFT_JPEG_Decoder *dec, uint8_t scale, TFT_JPEG_Output output, void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
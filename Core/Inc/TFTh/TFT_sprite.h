@@ -0,0 +1,148 @@
+/*
+ * @file    TFT_sprite.h
+ * @brief   TFT屏幕精灵 (可移动的透明色图片) 头文件
+ * @details 精灵叠加在背景上，移动时在发送缓冲区中合成新旧位置覆盖的区域，一次发送，不闪烁。
+ */
+#ifndef __TFT_SPRITE_H
+#define __TFT_SPRITE_H
+
+#include "main.h"
+#include "TFTh/TFT_io.h" // 包含TFT_io.h以获取TFT_HandleTypeDef结构体定义
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief  背景函数: 生成屏幕一行中一段像素的背景
+     * @param  context 用户上下文
+     * @param  x       起始列坐标
+     * @param  y       行坐标
+     * @param  width   像素数
+     * @param  pixels  输出 RGB565 像素 (每像素 2 字节，高字节在前)
+     */
+    typedef void (*TFT_Sprite_Background_Func)(void *context, int16_t x, int16_t y, uint16_t width, uint8_t *pixels);
+
+    /**
+     * @brief  精灵
+     */
+    typedef struct
+    {
+        const uint8_t *data; // RGB565 像素 (逐行存放，高字节在前，可以在 Flash 中)
+        uint16_t width;      // 宽度
+        uint16_t height;     // 高度
+        uint16_t key;        // 透明色: 等于此颜色的像素不绘制，显示下面的精灵或背景
+        int16_t x;           // 当前左上角列坐标 (可为负数)
+        int16_t y;           // 当前左上角行坐标
+        uint8_t visible;     // 是否显示
+    } TFT_Sprite;
+
+    /**
+     * @brief  精灵场景: 背景和按从下到上顺序叠放的精灵
+     */
+    typedef struct
+    {
+        TFT_Sprite_Background_Func background; // 背景函数 (NULL: 黑色)
+        void *background_context;              // 背景函数的上下文
+        TFT_Sprite *sprites[TFT_SPRITE_MAX];   // 精灵 (下标越大越靠上)
+        uint8_t count;                         // 精灵数量
+    } TFT_Sprite_Scene;
+
+    /**
+     * @brief  存储的背景图片 (配合 TFT_Sprite_Background_Bitmap 使用)
+     */
+    typedef struct
+    {
+        const uint8_t *data; // RGB565 位图 (逐行存放，高字节在前)，左上角位于屏幕 (0, 0)
+        uint16_t width;      // 位图宽度
+        uint16_t height;     // 位图高度
+        uint16_t color;      // 位图以外区域的颜色
+    } TFT_Sprite_Bitmap;
+
+    /**
+     * @brief  纯色背景函数
+     * @param  context 指向背景颜色 (uint16_t) 的指针
+     */
+    void TFT_Sprite_Background_Color(void *context, int16_t x, int16_t y, uint16_t width, uint8_t *pixels);
+
+    /**
+     * @brief  位图背景函数
+     * @param  context TFT_Sprite_Bitmap 指针
+     */
+    void TFT_Sprite_Background_Bitmap(void *context, int16_t x, int16_t y, uint16_t width, uint8_t *pixels);
+
+    /**
+     * @brief  初始化场景
+     * @param  scene      场景
+     * @param  background 背景函数 (TFT_Sprite_Background_Color、TFT_Sprite_Background_Bitmap、TFT_Tilemap_Background 或自定义的程序生成背景，NULL 时为黑色背景)
+     * @param  context    背景函数的上下文
+     * @retval 无
+     * @note   不绘制任何内容，假定屏幕上已经是该背景 (需要时用 TFT_Sprite_Redraw 绘制)。
+     */
+    void TFT_Sprite_Scene_Init(TFT_Sprite_Scene *scene, TFT_Sprite_Background_Func background, void *context);
+
+    /**
+     * @brief  初始化精灵 (初始不显示)
+     * @param  sprite 精灵
+     * @param  data   RGB565 像素 (高字节在前)
+     * @param  width  宽度
+     * @param  height 高度
+     * @param  key    透明色
+     * @retval 无
+     */
+    void TFT_Sprite_Init(TFT_Sprite *sprite, const uint8_t *data, uint16_t width, uint16_t height, uint16_t key);
+
+    /**
+     * @brief  把精灵加入场景，放在最上层
+     * @param  htft   TFT句柄指针
+     * @param  scene  场景
+     * @param  sprite 精灵
+     * @retval 无
+     * @note   最多 TFT_SPRITE_MAX 个，超出时忽略。精灵已显示时立即绘制。
+     */
+    void TFT_Sprite_Add(TFT_HandleTypeDef *htft, TFT_Sprite_Scene *scene, TFT_Sprite *sprite);
+
+    /**
+     * @brief  移动精灵 (未显示时同时显示)
+     * @param  htft   TFT句柄指针
+     * @param  scene  场景
+     * @param  sprite 精灵
+     * @param  x      新的左上角列坐标 (可为负数)
+     * @param  y      新的左上角行坐标
+     * @retval 无
+     * @note   旧位置和新位置的外接矩形 (两者相距较远时分别处理) 逐行在发送缓冲区中合成:
+     *         先由背景函数生成背景，再按从下到上的顺序叠加与之相交的精灵的非透明色像素，
+     *         整个区域只设置一次窗口、发送一次，没有先擦除再绘制的闪烁。只绘制剪裁矩形内的部分。
+     */
+    void TFT_Sprite_Move(TFT_HandleTypeDef *htft, TFT_Sprite_Scene *scene, TFT_Sprite *sprite, int16_t x, int16_t y);
+
+    /**
+     * @brief  显示或隐藏精灵
+     * @param  htft    TFT句柄指针
+     * @param  scene   场景
+     * @param  sprite  精灵
+     * @param  visible 1: 显示, 0: 隐藏 (恢复背景和下面的精灵)
+     * @retval 无
+     */
+    void TFT_Sprite_Show(TFT_HandleTypeDef *htft, TFT_Sprite_Scene *scene, TFT_Sprite *sprite, uint8_t visible);
+
+    /**
+     * @brief  重绘场景的一个区域 (背景和其中的精灵)
+     * @param  htft   TFT句柄指针
+     * @param  scene  场景
+     * @param  x      区域左上角列坐标
+     * @param  y      区域左上角行坐标
+     * @param  width  区域宽度
+     * @param  height 区域高度
+     * @retval 无
+     * @note   用于首次绘制整个场景，或精灵图片、背景内容改变后刷新。
+     */
+    void TFT_Sprite_Redraw(TFT_HandleTypeDef *htft, TFT_Sprite_Scene *scene, int16_t x, int16_t y, uint16_t width, uint16_t height);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
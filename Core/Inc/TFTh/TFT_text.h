@@ -8,6 +8,7 @@
 
 #include "main.h"
 #include "TFTh/TFT_io.h" // 包含TFT_io.h以获取TFT_HandleTypeDef结构体定义
+#include "TFTh/font.h"   // 包含字库结构体定义
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -15,6 +16,21 @@ extern "C"
 {
 #endif
 
+    /**
+     * @brief  文本框: 记住上次显示的内容，更新时只重绘变化的字符
+     * @note   适合每帧刷新的计数器、读数等。用 TFT_TextField_Init 初始化后反复调用 TFT_TextField_Update。
+     */
+    typedef struct
+    {
+        uint16_t x;                           // 起始列坐标
+        uint16_t y;                           // 起始行坐标
+        uint8_t size;                         // 字体大小 (8, 12, 16, 24)
+        uint16_t color;                       // 字符颜色
+        uint16_t back_color;                  // 背景颜色
+        uint8_t length;                       // 上次显示的字符数
+        uint8_t text[TFT_TEXT_FIELD_MAX + 1]; // 上次显示的内容
+    } TFT_TextField;
+
     /**
      * @brief  在指定位置显示一个 ASCII 字符
      * @param  htft TFT句柄指针
@@ -23,7 +39,7 @@ extern "C"
      * @param  chr        要显示的 ASCII 字符
      * @param  color      字符颜色
      * @param  back_color 背景颜色
-     * @param  size       字体大小 (支持 8, 12, 16)
+     * @param  size       字体大小 (支持 8, 12, 16, 24)
      * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
      * @retval 无
      */
@@ -37,12 +53,146 @@ extern "C"
      * @param  str        要显示的 ASCII 字符串
      * @param  color      字符颜色
      * @param  back_color 背景颜色
-     * @param  size       字体大小 (支持 8, 12, 16)
+     * @param  size       字体大小 (支持 8, 12, 16, 24)
      * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
      * @retval 无
+     * @note   背景不透明时整段文字只设置一次地址窗口，逐扫描线输出所有字符，
+     *         每段最多 TFT_TEXT_RUN_MAX 个字符；背景透明时只写入前景像素，
+     *         可叠加在渐变或图片上，开销只与点亮像素的线段数有关。
      */
     void TFT_Show_String(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, uint16_t color, uint16_t back_color, uint8_t size, uint8_t mode);
 
+    /**
+     * @brief  在指定位置按整数倍放大显示 ASCII 字符串
+     * @param  htft TFT句柄指针
+     * @param  x          起始列坐标
+     * @param  y          起始行坐标
+     * @param  str        要显示的 ASCII 字符串
+     * @param  color      字符颜色
+     * @param  back_color 背景颜色
+     * @param  size       字体大小 (支持 8, 12, 16, 24)
+     * @param  scale      放大倍数 (1 为原始大小，0 按 1 处理)
+     * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+     * @retval 无
+     * @note   每个字模位在输出时展开为 scale x scale 个像素，大号读数可直接由小字库生成，
+     *         不占用额外 Flash；窗口设置次数与原始大小相同。
+     */
+    void TFT_Show_String_Scaled(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, uint16_t color, uint16_t back_color, uint8_t size, uint8_t scale, uint8_t mode);
+
+    /**
+     * @brief  初始化文本框
+     * @param  field      文本框
+     * @param  x          起始列坐标
+     * @param  y          起始行坐标
+     * @param  size       字体大小 (支持 8, 12, 16, 24)
+     * @param  color      字符颜色
+     * @param  back_color 背景颜色
+     * @retval 无
+     * @note   初始化后文本框为空，第一次更新时完整绘制。
+     */
+    void TFT_TextField_Init(TFT_TextField *field, uint16_t x, uint16_t y, uint8_t size, uint16_t color, uint16_t back_color);
+
+    /**
+     * @brief  更新文本框内容
+     * @param  htft  TFT句柄指针
+     * @param  field 文本框
+     * @param  str   新的 ASCII 字符串 (超过 TFT_TEXT_FIELD_MAX 的部分不显示)
+     * @retval 无
+     * @note   与上次内容逐字比较，只重绘变化的字符 (连续变化的字符一次窗口写入)；
+     *         新内容比上次短时用背景色清除多出的字符格。
+     */
+    void TFT_TextField_Update(TFT_HandleTypeDef *htft, TFT_TextField *field, const uint8_t *str);
+
+    /**
+     * @brief  使文本框下次更新时完整重绘
+     * @param  field 文本框
+     * @retval 无
+     * @note   文本框所在区域被清屏或其他内容覆盖后调用。
+     */
+    void TFT_TextField_Invalidate(TFT_TextField *field);
+
+    /**
+     * @brief  格式化更新文本框内容 (printf 风格)
+     * @param  htft  TFT句柄指针
+     * @param  field 文本框
+     * @param  fmt   格式字符串 (同 TFT_Printf)
+     * @retval 无
+     * @note   格式化结果超过 TFT_TEXT_FIELD_MAX 的部分丢弃，只重绘变化的字符。
+     */
+    void TFT_TextField_Printf(TFT_HandleTypeDef *htft, TFT_TextField *field, const char *fmt, ...);
+
+    /**
+     * @brief  在指定位置格式化显示 ASCII 字符串 (printf 风格)
+     * @param  htft TFT句柄指针
+     * @param  x          起始列坐标
+     * @param  y          起始行坐标
+     * @param  color      字符颜色
+     * @param  back_color 背景颜色
+     * @param  size       字体大小 (支持 8, 12, 16, 24)
+     * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+     * @param  fmt        格式字符串
+     * @retval 输出的字符数
+     * @note   支持 %d %i %u %x %X %c %s %f %k %%，标志 '-' '0' '+'，宽度 (最大 255)、精度 (最大 127) 和长度修饰 'l'；
+     *         %f 精度 0~9 (默认 6)，不需要 newlib 的浮点 printf (-u _printf_float)；
+     *         %k 为十进制定点数，整数参数表示 数值 x 10^精度，如 TFT_Printf(..., "%.3kV", 3300) 显示 3.300V；
+     *         '\n' 换到下一行的起始列。格式化结果直接送入字模段输出，不经过中间字符串。
+     */
+    uint16_t TFT_Printf(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint16_t color, uint16_t back_color, uint8_t size, uint8_t mode, const char *fmt, ...);
+
+    /**
+     * @brief  在指定位置显示 UTF-8 字符串 (支持中文)
+     * @param  htft TFT句柄指针
+     * @param  x          起始列坐标
+     * @param  y          起始行坐标
+     * @param  str        要显示的 UTF-8 字符串
+     * @param  font       字库指针 (如 &font16x16)
+     * @param  color      字符颜色
+     * @param  back_color 背景颜色
+     * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+     * @retval 无
+     * @note   字库通过排序索引二分查找字模；字库中没有的 ASCII 字符使用 font->ascii 显示，
+     *         其他找不到的字符跳过。中英文混排同样整段只设置一次地址窗口。
+     */
+    void TFT_Show_UTF8(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, const Font *font, uint16_t color, uint16_t back_color, uint8_t mode);
+
+    /**
+     * @brief  在指定位置用比例字体显示 ASCII 字符串
+     * @param  htft TFT句柄指针
+     * @param  x          起始列坐标
+     * @param  y          起始行坐标 (行顶部)
+     * @param  str        要显示的 ASCII 字符串
+     * @param  font       比例字体 (如 &pfont16)
+     * @param  color      字符颜色
+     * @param  back_color 背景颜色
+     * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+     * @retval 无
+     * @note   每个字按自身步进宽度排列并应用字距调整表，压缩的字模在输出时直接解码，
+     *         背景不透明时整段只设置一次地址窗口。
+     */
+    void TFT_Show_Prop_String(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, const PropFont *font, uint16_t color, uint16_t back_color, uint8_t mode);
+
+    /**
+     * @brief  计算比例字体字符串的显示宽度
+     * @param  str  ASCII 字符串
+     * @param  font 比例字体
+     * @retval 宽度 (像素，含字距调整)，可用于右对齐或居中
+     */
+    uint16_t TFT_Prop_String_Width(const uint8_t *str, const PropFont *font);
+
+    /**
+     * @brief  在指定位置用抗锯齿字体显示 ASCII 字符串
+     * @param  htft TFT句柄指针
+     * @param  x          起始列坐标
+     * @param  y          起始行坐标
+     * @param  str        要显示的 ASCII 字符串 (超出字体范围的字符显示为第一个字符)
+     * @param  font       抗锯齿字体 (如 &aafont24x12)
+     * @param  color      字符颜色
+     * @param  back_color 背景颜色 (边缘像素按该颜色预先混合，只能显示在纯色背景上)
+     * @retval 无
+     * @note   按 (前景色, 背景色) 预先计算 4 或 16 级色阶表，每像素只需一次查表。
+     */
+    void TFT_Show_AA_String(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, const AAFont *font, uint16_t color, uint16_t back_color);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,91 @@
+/*
+ * @file    TFT_tilemap.h
+ * @brief   TFT屏幕图块地图 (Tile Map) 背景头文件
+ * @details 背景由 Flash 中的 4 位调色板图块和 RAM 中的图块编号表拼成，逐行带生成到发送缓冲区中发送，
+ *          整屏画面只需要几百字节的地图。
+ */
+#ifndef __TFT_TILEMAP_H
+#define __TFT_TILEMAP_H
+
+#include "main.h"
+#include "TFTh/TFT_io.h" // 包含TFT_io.h以获取TFT_HandleTypeDef结构体定义
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+    /**
+     * @brief  图块地图
+     * @note   图块数据: 每个图块 tile_size x tile_size 像素，逐行存放，每像素 4 位调色板序号 (高 4 位在左)，
+     *         8x8 图块 32 字节，16x16 图块 128 字节。地图: 每格 1 字节图块编号，逐行存放。
+     *         地图在屏幕上从 (0, 0) 开始，屏幕坐标 (x, y) 显示地图像素 (x + scroll_x, y + scroll_y)，
+     *         超出地图的部分循环重复。
+     */
+    typedef struct
+    {
+        const uint8_t *tiles;    // 图块数据 (可以在 Flash 中)
+        const uint16_t *palette; // 调色板: 16 个 RGB565 颜色
+        uint8_t *cells;          // 地图: 每格的图块编号 (在 RAM 中，可随时修改)
+        uint16_t columns;        // 地图列数 (图块数)
+        uint16_t rows;           // 地图行数 (图块数)
+        uint8_t tile_size;       // 图块边长: 8 或 16
+        uint16_t scroll_x;       // 水平滚动偏移 (像素)
+        uint16_t scroll_y;       // 垂直滚动偏移 (像素)
+    } TFT_Tilemap;
+
+    /**
+     * @brief  初始化图块地图 (滚动偏移为 0)
+     * @param  map       图块地图
+     * @param  tiles     图块数据
+     * @param  tile_size 图块边长 (8 或 16)
+     * @param  palette   16 色调色板
+     * @param  cells     地图 (columns x rows 字节)
+     * @param  columns   地图列数
+     * @param  rows      地图行数
+     * @retval 无
+     */
+    void TFT_Tilemap_Init(TFT_Tilemap *map, const uint8_t *tiles, uint8_t tile_size, const uint16_t *palette,
+                          uint8_t *cells, uint16_t columns, uint16_t rows);
+
+    /**
+     * @brief  设置滚动偏移 (不绘制，需要时用 TFT_Draw_Tilemap 重绘)
+     * @param  map      图块地图
+     * @param  scroll_x 水平偏移 (像素，超出地图宽度时取余)
+     * @param  scroll_y 垂直偏移 (像素)
+     * @retval 无
+     */
+    void TFT_Tilemap_Scroll(TFT_Tilemap *map, uint16_t scroll_x, uint16_t scroll_y);
+
+    /**
+     * @brief  绘制图块地图的一个屏幕区域
+     * @param  htft   TFT句柄指针
+     * @param  map    图块地图
+     * @param  x      区域左上角列坐标
+     * @param  y      区域左上角行坐标
+     * @param  width  区域宽度
+     * @param  height 区域高度
+     * @retval 无
+     * @note   只设置一次窗口，像素逐行查表生成到发送缓冲区的一个半区，DMA 同时发送另一个半区。
+     *         只绘制剪裁矩形内的部分。
+     */
+    void TFT_Draw_Tilemap(TFT_HandleTypeDef *htft, const TFT_Tilemap *map, int16_t x, int16_t y, uint16_t width, uint16_t height);
+
+    /**
+     * @brief  图块地图背景函数 (TFT_Sprite_Background_Func)，精灵可以叠加在图块地图上
+     * @param  context TFT_Tilemap 指针
+     * @param  x       起始列坐标
+     * @param  y       行坐标
+     * @param  width   像素数
+     * @param  pixels  输出 RGB565 像素 (高字节在前)
+     * @retval 无
+     * @note   地图为空 (0 列或 0 行) 时输出黑色。
+     */
+    void TFT_Tilemap_Background(void *context, int16_t x, int16_t y, uint16_t width, uint8_t *pixels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -2,11 +2,18 @@
 #define __FONT_H
 #include "stdint.h"
 #include "string.h"
+/**
+ * @brief 字模数据排列方式
+ */
+#define FONT_LAYOUT_PAGE 0 // 列行式 (OLED 取模默认): 每 8 行为一页，页内每列 1 字节，LSB 在上
+#define FONT_LAYOUT_ROW 1  // 逐行式: 每行 (w+7)/8 字节，LSB 在左
+
 typedef struct ASCIIFont
 {
   uint8_t h;
   uint8_t w;
   uint8_t *chars;
+  uint8_t layout; // 字模排列方式 (FONT_LAYOUT_PAGE / FONT_LAYOUT_ROW)
 } ASCIIFont;
 
 extern const ASCIIFont afont8x6;
@@ -26,10 +33,81 @@ typedef struct Font
   const uint8_t *chars;   // 字库 字库前4字节存储utf8编码 剩余字节存储字模数据
   uint8_t len;            // 字库长度 超过256则请改为uint16_t
   const ASCIIFont *ascii; // 缺省ASCII字体 当字库中没有对应字符且需要显示ASCII字符时使用
+  const uint8_t *index;   // 按utf8编码从小到大排列的字序号表 用于二分查找 为NULL时顺序查找
 } Font;
 
 extern const Font font16x16;
 
+/**
+ * @brief 比例字体的单个字 (4 字节)
+ * @note  字模只保存包围盒内的像素，按位流编码 (LSB 在前，每个字从整字节开始):
+ *        第一行直接存 width 位像素；以后每行先存 1 位，为 1 表示与上一行相同，
+ *        为 0 时后跟该行的 width 位像素。竖笔画较多的字大部分行只占 1 位。
+ *        各字段用下面的 PROP_GLYPH_* 宏读取，用 PROP_GLYPH() 初始化。
+ */
+typedef struct PropGlyph
+{
+  uint16_t offset_width; // 低 12 位: 字模数据在 bitmap 中的偏移, 高 4 位: 包围盒宽度 (0 表示没有像素，如空格)
+  uint8_t box;           // 低 4 位: 包围盒高度 - 1, 高 4 位: 包围盒上边相对行顶部的偏移
+  uint8_t metrics;       // 低 4 位: 画完该字后笔位置前进的宽度, 高 4 位: 包围盒左边相对笔位置的偏移 (-8 ~ 7)
+} PropGlyph;
+
+#define PROP_GLYPH(offset, width, height, x_offset, y_offset, advance) \
+  {(uint16_t)((offset) | ((width) << 12)), (uint8_t)((((height) - 1) & 0x0F) | ((y_offset) << 4)), \
+   (uint8_t)((advance) | (((x_offset) & 0x0F) << 4))}
+
+#define PROP_GLYPH_OFFSET(g) ((g)->offset_width & 0x0FFF)
+#define PROP_GLYPH_WIDTH(g) ((g)->offset_width >> 12)
+#define PROP_GLYPH_HEIGHT(g) (((g)->box & 0x0F) + 1)
+#define PROP_GLYPH_Y_OFFSET(g) ((g)->box >> 4)
+#define PROP_GLYPH_ADVANCE(g) ((g)->metrics & 0x0F)
+#define PROP_GLYPH_X_OFFSET(g) ((int8_t)((((g)->metrics >> 4) ^ 0x08) - 0x08))
+
+/**
+ * @brief 字距调整表项 (按 left、right 从小到大排列)
+ */
+typedef struct PropKern
+{
+  uint8_t left;   // 左侧字符
+  uint8_t right;  // 右侧字符
+  int8_t adjust;  // 两字之间的步进修正 (像素，负数表示收紧)
+} PropKern;
+
+/**
+ * @brief 比例字体结构体
+ * @note  数据可用 Tools/gen_prop_font.py 生成
+ */
+typedef struct PropFont
+{
+  uint8_t h;                 // 行高
+  uint8_t first;             // 第一个字符
+  uint8_t last;              // 最后一个字符
+  const PropGlyph *glyphs;   // 字表 (last - first + 1 项)
+  const uint8_t *bitmap;     // 字模数据
+  const PropKern *kerning;   // 字距调整表 为NULL时不调整
+  uint16_t kerning_len;      // 字距调整表长度
+} PropFont;
+
+extern const PropFont pfont16;
+
+/**
+ * @brief 抗锯齿字体结构体
+ * @note  每个像素用 bpp 位灰度表示前景覆盖率 (0 为背景，最大值为前景)，
+ *        字模逐行存放，每行 (w*bpp+7)/8 字节，一个字节内先出现的像素在高位
+ * @note  数据可用 Tools/gen_aa_font.py 生成
+ */
+typedef struct AAFont
+{
+  uint8_t h;           // 字高度
+  uint8_t w;           // 字宽度
+  uint8_t bpp;         // 每像素位数 (2 或 4)
+  uint8_t first;       // 第一个字符
+  uint8_t last;        // 最后一个字符
+  const uint8_t *data; // 字模数据
+} AAFont;
+
+extern const AAFont aafont24x12;
+
 /**
  * @brief 图片结构体
  * @note  图片数据可以使用波特律动LED取模助手生成(https://led.baud-dance.com)
@@ -44,4 +122,17 @@ typedef struct Image
 extern const Image bilibiliImg;
 extern const Image A001Img;
 
+/**
+ * @brief QOI 风格压缩的 RGB565 图片
+ * @note  每个像素用 1~3 字节编码: 重复上一像素的游程、最近 64 种颜色的索引、与上一像素的小差值或原值。
+ *        编码格式见 Tools/gen_packed_image.py，由该脚本从图片文件生成。
+ */
+typedef struct PackedImage
+{
+  uint16_t w;          // 图片宽度
+  uint16_t h;          // 图片高度
+  const uint8_t *data; // 压缩数据
+  uint32_t size;       // 压缩数据字节数
+} PackedImage;
+
 #endif // __FONT_H
@@ -5,7 +5,6 @@
 #include "TFTh/TFT_CAD.h"
 #include "TFTh/TFT_io.h" // 包含底层 IO 函数
 #include <stdlib.h>		 // 用于 abs 函数
-#include <math.h>
 
 // 宏定义：交换两个 int16_t 变量的值
 #define SWAP_INT16(a, b) \
@@ -15,6 +14,19 @@
 		b = t;           \
 	}
 
+// 四分之一周期正弦表: sin(0°) ~ sin(90°)，Q15 定点 (32767 表示 1.0)，其余象限由对称性得到
+static const int16_t TFT_Sine_Table[91] = {
+	0, 572, 1144, 1715, 2286, 2856, 3425, 3993, 4560, 5126,
+	5690, 6252, 6813, 7371, 7927, 8481, 9032, 9580, 10126, 10668,
+	11207, 11743, 12275, 12803, 13328, 13848, 14364, 14876, 15383, 15886,
+	16383, 16876, 17364, 17846, 18323, 18794, 19260, 19720, 20173, 20621,
+	21062, 21497, 21925, 22347, 22762, 23170, 23571, 23964, 24351, 24730,
+	25101, 25465, 25821, 26169, 26509, 26841, 27165, 27481, 27788, 28087,
+	28377, 28659, 28932, 29196, 29451, 29697, 29934, 30162, 30381, 30591,
+	30791, 30982, 31163, 31335, 31498, 31650, 31794, 31927, 32051, 32165,
+	32269, 32364, 32448, 32523, 32587, 32642, 32687, 32722, 32747, 32762,
+	32767};
+
 /**
  * @brief  在指定坐标绘制一个点
  * @param  htft    TFT句柄指针
@@ -68,6 +80,7 @@ void TFT_Draw_MultiPoint(TFT_HandleTypeDef *htft, const TFT_Point points[], uint
  * @param  y_end     结束行坐标 (不包含)
  * @param  color     要填充的颜色 (RGB565格式)
  * @retval 无
+ * @note   返回时最后一块数据可能仍在 DMA 发送中，后续任何 IO 操作都会先等待其完成。
  */
 void TFT_Fill_Area(TFT_HandleTypeDef *htft, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end, uint16_t color)
 {
@@ -79,19 +92,12 @@ void TFT_Fill_Area(TFT_HandleTypeDef *htft, uint16_t x_start, uint16_t y_start,
 	if (total_pixels == 0)
 		return;
 
+	// 先在空闲半区准备好纯色数据 (可与上一次填充的 DMA 传输并行)，再设置窗口
+	TFT_Buffer_Prepare_Color(htft, color);
 	TFT_Set_Address(htft, x_start, y_start, x_end - 1, y_end - 1); // 设置显示范围 (Set_Address 使用包含的坐标)
 
-	// 重置缓冲区以确保从一个干净的缓冲区开始
-	TFT_Reset_Buffer(htft);
-
-	// 批量填充像素，利用缓冲区提高性能
-	for (uint32_t i = 0; i < total_pixels; i++)
-	{
-		TFT_Buffer_Write16(htft, color); // 写入颜色数据到缓冲区，缓冲区满时会自动发送
-	}
-
-	// 确保所有剩余数据都被发送
-	TFT_Flush_Buffer(htft, 1);
+	// 重复发送预填充的半区，不等待最后一块传输完成
+	TFT_Write_Color_Repeat(htft, color, total_pixels);
 }
 
 /**
@@ -917,7 +923,7 @@ void TFT_Fill_Ellipse(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t center
 }
 
 /**
- * @brief  绘制二阶贝塞尔曲线
+ * @brief  绘制二阶贝塞尔曲线 (整数前向差分)
  * @param  htft TFT句柄指针
  * @param  x0, y0 起始点坐标
  * @param  x1, y1 控制点坐标
@@ -925,11 +931,12 @@ void TFT_Fill_Ellipse(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t center
  * @param  segments 曲线分段数(越大越平滑)
  * @param  color 曲线颜色 (RGB565格式)
  * @retval 无
+ * @note   B(t) = A*t² + B*t + C，取 t = i/n 并整体乘以 n² 后全部为整数，
+ *         逐段只需两次加法，每个点一次整数除法，不使用浮点运算。
  */
 void TFT_Draw_Bezier2(TFT_HandleTypeDef *htft, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
 					  uint16_t x2, uint16_t y2, uint8_t segments, uint16_t color)
 {
-	float t, t2, t_1, t_12;
 	uint16_t x, y, lx = x0, ly = y0;
 
 	// 分段数不能为0
@@ -938,20 +945,37 @@ void TFT_Draw_Bezier2(TFT_HandleTypeDef *htft, uint16_t x0, uint16_t y0, uint16_
 		segments = 1;
 	}
 
+	int32_t n = segments;
+	int32_t n2 = n * n;
+
+	// 多项式系数: A = P0 - 2P1 + P2, B = 2(P1 - P0), C = P0
+	int32_t ax = (int32_t)x0 - 2 * (int32_t)x1 + x2;
+	int32_t ay = (int32_t)y0 - 2 * (int32_t)y1 + y2;
+	int32_t bx = 2 * ((int32_t)x1 - x0);
+	int32_t by = 2 * ((int32_t)y1 - y0);
+
+	// 前向差分初值 (均已乘以 n²)
+	int32_t px = (int32_t)x0 * n2; // n²·B(0)
+	int32_t py = (int32_t)y0 * n2;
+	int32_t d1x = ax + bx * n; // 一阶差分 n²·(B(1/n) - B(0))
+	int32_t d1y = ay + by * n;
+	int32_t d2x = 2 * ax; // 二阶差分为常数
+	int32_t d2y = 2 * ay;
+
 	// 绘制第一个点 (t=0)
 	TFT_Draw_Point(htft, x0, y0, color);
 
 	// 逐段计算贝塞尔曲线点并绘制线段
 	for (uint8_t i = 1; i <= segments; i++)
 	{
-		t = i / (float)segments; // t 从 1/segments 到 1
-		t2 = t * t;
-		t_1 = 1.0f - t;
-		t_12 = t_1 * t_1;
+		px += d1x;
+		py += d1y;
+		d1x += d2x;
+		d1y += d2y;
 
-		// 二阶贝塞尔曲线公式: B(t) = (1-t)²*P0 + 2(1-t)*t*P1 + t²*P2
-		x = t_12 * x0 + 2 * t_1 * t * x1 + t2 * x2;
-		y = t_12 * y0 + 2 * t_1 * t * y1 + t2 * y2;
+		// 曲线位于控制点凸包内，坐标恒为非负，四舍五入还原到像素坐标
+		x = (px + n2 / 2) / n2;
+		y = (py + n2 / 2) / n2;
 
 		// 绘制当前线段
 		TFT_Draw_Line(htft, lx, ly, x, y, color);
@@ -983,155 +1007,1593 @@ void TFT_Draw_Polygon(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_
 	TFT_Draw_Line(htft, points[numPoints - 1].x, points[numPoints - 1].y, points[0].x, points[0].y, color);
 }
 
+//----------------- 水平线段汇集器 -----------------
+
 /**
- * @brief  填充简单多边形（不处理复杂情况如自交）
- * @param  htft TFT句柄指针
- * @param  points 多边形顶点坐标数组
- * @param  numPoints 顶点数量
- * @param  color 填充颜色
+ * @brief  把汇集器中暂存的矩形发送到屏幕 (内部辅助函数)
+ * @param  sink 汇集器
  * @retval 无
- * @note   使用水平扫描线算法，仅适用于简单多边形
  */
-void TFT_Fill_Polygon(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_t numPoints, uint16_t color)
+static void TFT_Span_Flush(TFT_Span_Sink *sink)
 {
-	if (numPoints < 3 || points == NULL)
+	if (sink->width == 0)
 		return;
 
-	// 1. 找到多边形的边界框
-	int16_t minY = points[0].y;
-	int16_t maxY = points[0].y;
+	TFT_Fill_Area(sink->htft, sink->x, sink->y, sink->x + sink->width, sink->y + sink->height, sink->color);
+	sink->width = 0;
+	sink->height = 0;
+}
 
-	for (uint16_t i = 1; i < numPoints; i++)
+/**
+ * @brief  开始一组水平线段输出
+ * @param  sink  汇集器
+ * @param  htft  TFT句柄指针
+ * @param  color 填充颜色 (RGB565格式)
+ * @retval 无
+ */
+void TFT_Span_Begin(TFT_Span_Sink *sink, TFT_HandleTypeDef *htft, uint16_t color)
+{
+	sink->htft = htft;
+	sink->color = color;
+	sink->x = 0;
+	sink->y = 0;
+	sink->width = 0;
+	sink->height = 0;
+}
+
+/**
+ * @brief  输出一条水平线段
+ * @param  sink  汇集器
+ * @param  x     起始列坐标 (可以为负，超出左边界的部分被裁掉)
+ * @param  y     行坐标 (为负时整条线段被丢弃)
+ * @param  width 线段宽度 (像素)
+ * @retval 无
+ */
+void TFT_Span_Add(TFT_Span_Sink *sink, int16_t x, int16_t y, int16_t width)
+{
+	// 裁剪到屏幕左/上边界
+	if (x < 0)
+	{
+		width += x;
+		x = 0;
+	}
+	if (width <= 0 || y < 0)
+		return;
+
+	if (sink->width != 0)
+	{
+		// 与上一行起止列相同: 矩形向下扩展一行
+		if (x == sink->x && width == sink->width && y == sink->y + sink->height)
+		{
+			sink->height++;
+			return;
+		}
+		// 同一行首尾相接: 矩形向右扩展
+		if (sink->height == 1 && y == sink->y && x == sink->x + sink->width)
+		{
+			sink->width += width;
+			return;
+		}
+		TFT_Span_Flush(sink);
+	}
+
+	sink->x = x;
+	sink->y = y;
+	sink->width = width;
+	sink->height = 1;
+}
+
+/**
+ * @brief  结束一组水平线段输出，发送剩余的暂存矩形
+ * @param  sink 汇集器
+ * @retval 无
+ */
+void TFT_Span_End(TFT_Span_Sink *sink)
+{
+	TFT_Span_Flush(sink);
+}
+
+//----------------- 边表扫描线填充 -----------------
+
+/**
+ * @brief  多边形边 (边表/活动边表节点)
+ * @note   顶点坐标使用 Q4 定点 (1/16 像素)，像素 (px, py) 的中心位于 (px*16, py*16)。
+ *         边覆盖半开区间 [yTop, yBottom) 内的扫描线。
+ */
+typedef struct
+{
+	int32_t x;		 // 当前扫描线处的 X 坐标 (Q16 像素，向下取整)
+	int32_t dxdy;	 // 每下移一行 X 的增量的整数部分 (Q16 像素)
+	int32_t error;	 // X 的小数余项分子 (0 ~ dy-1)
+	int32_t rem;	 // 每行余项增量
+	int32_t dy;		 // 余项分母 (边的高度，Q4)
+	int16_t yTop;	 // 第一条扫描线 (含)
+	int16_t yBottom; // 最后一条扫描线 (不含)
+	int8_t winding;	 // 边方向: +1 向下, -1 向上 (非零规则使用)
+} TFT_Poly_Edge;
+
+/**
+ * @brief  边表
+ */
+typedef struct
+{
+	TFT_Poly_Edge *edges; // 边数组
+	uint16_t *active;	  // 活动边表 (按 X 排序的边序号)
+	uint16_t count;		  // 已加入的边数
+	uint16_t capacity;	  // 最大边数
+} TFT_Edge_Table;
+
+/**
+ * @brief  为边表分配内存 (内部辅助函数)
+ * @param  table 边表
+ * @param  capacity 最大边数
+ * @retval 1=成功, 0=内存不足
+ */
+static uint8_t TFT_Edge_Table_Init(TFT_Edge_Table *table, uint16_t capacity)
+{
+	table->count = 0;
+	table->capacity = capacity;
+	table->edges = (TFT_Poly_Edge *)malloc((uint32_t)capacity * (sizeof(TFT_Poly_Edge) + sizeof(uint16_t)));
+	if (table->edges == NULL)
+		return 0;
+	table->active = (uint16_t *)(table->edges + capacity);
+	return 1;
+}
+
+/**
+ * @brief  释放边表内存 (内部辅助函数)
+ * @param  table 边表
+ * @retval 无
+ */
+static void TFT_Edge_Table_Free(TFT_Edge_Table *table)
+{
+	free(table->edges);
+	table->edges = NULL;
+	table->count = 0;
+}
+
+/**
+ * @brief  向边表加入一条边 (内部辅助函数)
+ * @param  table 边表
+ * @param  x0, y0 起点 (Q4 定点)
+ * @param  x1, y1 终点 (Q4 定点)
+ * @retval 无
+ * @note   水平边和不跨过任何像素中心的短边被忽略。
+ */
+static void TFT_Edge_Table_Add(TFT_Edge_Table *table, int32_t x0, int32_t y0, int32_t x1, int32_t y1)
+{
+	int8_t winding = 1;
+
+	if (y0 == y1 || table->count >= table->capacity)
+		return;
+
+	// 统一为从上到下
+	if (y0 > y1)
 	{
-		if (points[i].y < minY)
-			minY = points[i].y;
-		if (points[i].y > maxY)
-			maxY = points[i].y;
+		int32_t t;
+		t = x0, x0 = x1, x1 = t;
+		t = y0, y0 = y1, y1 = t;
+		winding = -1;
 	}
 
-	// 边界框无效
-	if (minY >= maxY)
+	// 覆盖的扫描线: 满足 y0 <= py*16 < y1 的 py (向上取整)
+	int16_t yTop = (int16_t)((y0 + 15) >> 4);
+	int16_t yBottom = (int16_t)((y1 + 15) >> 4);
+	if (yTop >= yBottom)
 		return;
 
-	// 临时数组存储扫描线与多边形边的交点的X坐标
-	int16_t intersections[128]; // 根据实际需求调整大小
+	// X 用整数部分 + 余项的精确 DDA 表示，穿过同一顶点的不同边在该点得到完全相同的 X，
+	// 相邻轮廓的公共边界上不会出现缺口
+	int32_t dy = y1 - y0;
+	int64_t step = (int64_t)(x1 - x0) * 65536; // 每行 (16 个 Q4 单位) 的 X 增量分子
+	int64_t start = (int64_t)((int32_t)yTop * 16 - y0) * (x1 - x0) * 4096;
+	int64_t q;
+
+	TFT_Poly_Edge *edge = &table->edges[table->count++];
+	q = step / dy;
+	if (q * dy > step)
+		q--; // 向下取整
+	edge->dxdy = (int32_t)q;
+	edge->rem = (int32_t)(step - q * dy);
+	q = start / dy;
+	if (q * dy > start)
+		q--;
+	edge->x = x0 * 4096 + (int32_t)q; // 轮廓伸出屏幕左侧时 x0 为负数
+	edge->error = (int32_t)(start - q * dy);
+	edge->dy = dy;
+	edge->yTop = yTop;
+	edge->yBottom = yBottom;
+	edge->winding = winding;
+}
+
+/**
+ * @brief  扫描转换边表并通过水平线段汇集器输出 (内部辅助函数)
+ * @param  htft  TFT句柄指针
+ * @param  table 边表 (函数内会重新排序，扫描后边的 X 坐标被修改)
+ * @param  rule  填充规则
+ * @param  color 填充颜色
+ * @retval 无
+ * @note   边按 yTop 排序后依次进入活动边表；每行只对活动边做 X 增量更新和
+ *         插入排序 (相邻行顺序几乎不变，排序接近线性)，然后按规则配对输出线段。
+ */
+static void TFT_Edge_Table_Fill(TFT_HandleTypeDef *htft, TFT_Edge_Table *table, TFT_Fill_Rule rule, uint16_t color)
+{
+	TFT_Poly_Edge *edges = table->edges;
+	uint16_t *active = table->active;
+	uint16_t edgeCount = table->count;
+	uint16_t activeCount = 0;
+	uint16_t nextEdge = 0;
+	uint16_t i, j;
+	TFT_Span_Sink sink;
+
+	if (edgeCount < 2)
+		return;
 
-	// 2. 对每一扫描线，找出所有交点
-	for (int16_t y = minY; y <= maxY; y++)
+	// 1. 边表按起始扫描线排序 (插入排序，轮廓顺序生成的边通常已部分有序)
+	for (i = 1; i < edgeCount; i++)
 	{
-		uint8_t intersectCount = 0;
+		TFT_Poly_Edge temp = edges[i];
+		j = i;
+		while (j > 0 && edges[j - 1].yTop > temp.yTop)
+		{
+			edges[j] = edges[j - 1];
+			j--;
+		}
+		edges[j] = temp;
+	}
+
+	TFT_Span_Begin(&sink, htft, color);
 
-		// 检查每条边
-		for (uint16_t i = 0; i < numPoints; i++)
+	int16_t y = edges[0].yTop;
+	for (;;)
+	{
+		// 2. 移除已经结束的边
+		for (i = 0, j = 0; i < activeCount; i++)
 		{
-			// 获取当前边的两个端点
-			uint16_t j = (i + 1) % numPoints;
-			int16_t y1 = points[i].y;
-			int16_t y2 = points[j].y;
+			if (edges[active[i]].yBottom > y)
+				active[j++] = active[i];
+		}
+		activeCount = j;
 
-			// 如果扫描线与当前边相交
-			if ((y1 <= y && y2 > y) || (y2 <= y && y1 > y))
-			{
-				// 计算交点的X坐标
-				int16_t x1 = points[i].x;
-				int16_t x2 = points[j].x;
+		// 活动边表为空时直接跳到下一条边的起始行
+		if (activeCount == 0)
+		{
+			if (nextEdge >= edgeCount)
+				break;
+			if (edges[nextEdge].yTop > y)
+				y = edges[nextEdge].yTop;
+		}
 
-				// 使用线性插值计算交点X坐标
-				int32_t x;
-				if (y1 == y2)
-				{
-					// 边是水平的，取两端点的平均X坐标
-					x = (x1 + x2) / 2;
-				}
-				else
-				{
-					// 非水平边，计算交点X坐标
-					x = x1 + (int32_t)(y - y1) * (x2 - x1) / (y2 - y1);
-				}
+		// 3. 加入从本行开始的边
+		while (nextEdge < edgeCount && edges[nextEdge].yTop == y)
+		{
+			active[activeCount++] = nextEdge++;
+		}
 
-				// 存储交点
-				if (intersectCount < 128)
-				{
-					intersections[intersectCount++] = x;
-				}
+		// 4. 按当前 X 排序活动边
+		for (i = 1; i < activeCount; i++)
+		{
+			uint16_t temp = active[i];
+			int32_t tempX = edges[temp].x;
+			j = i;
+			while (j > 0 && edges[active[j - 1]].x > tempX)
+			{
+				active[j] = active[j - 1];
+				j--;
 			}
+			active[j] = temp;
 		}
 
-		// 3. 对交点按X坐标排序
-		// 插入排序
-		for (uint8_t i = 1; i < intersectCount; i++)
+		// 5. 按填充规则配对，输出像素中心落在 [左交点, 右交点) 内的线段 (与行方向同为左闭右开)
+		int16_t winding = 0;
+		int32_t spanStart = 0;
+		for (i = 0; i < activeCount; i++)
 		{
-			int16_t temp = intersections[i];
-			int16_t j = i;
-			while (j > 0 && intersections[j - 1] > temp)
+			TFT_Poly_Edge *edge = &edges[active[i]];
+			uint8_t inside;
+			uint8_t wasInside = (winding != 0);
+
+			if (rule == TFT_FILL_NONZERO)
+				winding += edge->winding;
+			else
+				winding ^= 1;
+			inside = (winding != 0);
+
+			if (!wasInside && inside)
 			{
-				intersections[j] = intersections[j - 1];
-				j--;
+				spanStart = edge->x;
+			}
+			else if (wasInside && !inside)
+			{
+				int32_t left = (spanStart + 0xFFFF) >> 16; // 向上取整
+				int32_t right = (edge->x + 0xFFFF) >> 16;  // 向上取整 (不含)
+				if (left < right)
+					TFT_Span_Add(&sink, (int16_t)left, y, (int16_t)(right - left));
 			}
-			intersections[j] = temp;
 		}
 
-		// 4. 成对连线绘制填充区域（注：跳过垂直边生成的重复交点）
-		for (uint8_t i = 0; i < intersectCount; i += 2)
+		// 6. 活动边 X 递增到下一行
+		for (i = 0; i < activeCount; i++)
 		{
-			if (i + 1 < intersectCount)
+			TFT_Poly_Edge *edge = &edges[active[i]];
+			edge->x += edge->dxdy;
+			edge->error += edge->rem;
+			if (edge->error >= edge->dy)
 			{
-				// 绘制水平线段
-				int16_t x1 = intersections[i];
-				int16_t x2 = intersections[i + 1];
-				TFT_Draw_Fast_HLine(htft, x1, y, x2 - x1 + 1, color);
+				edge->x++;
+				edge->error -= edge->dy;
 			}
 		}
+		y++;
 	}
+
+	TFT_Span_End(&sink);
 }
 
 /**
- * @brief  绘制圆弧
+ * @brief  填充多边形 (奇偶规则)
  * @param  htft TFT句柄指针
- * @param  centerX, centerY 圆心坐标
- * @param  radius 圆弧半径
- * @param  startAngle 起始角度(0-360度)
- * @param  endAngle 结束角度(0-360度)
- * @param  color 圆弧颜色
+ * @param  points 多边形顶点坐标数组
+ * @param  numPoints 顶点数量
+ * @param  color 填充颜色
  * @retval 无
  */
-void TFT_Draw_Arc(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint8_t radius,
-				  uint16_t startAngle, uint16_t endAngle, uint16_t color)
+void TFT_Fill_Polygon(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_t numPoints, uint16_t color)
 {
-	// 将角度限制在0-360范围内
-	startAngle = startAngle % 360;
-	endAngle = endAngle % 360;
+	TFT_Fill_Polygon_Rule(htft, points, numPoints, TFT_FILL_EVEN_ODD, color);
+}
 
-	// 确保终止角度大于起始角度
-	if (endAngle < startAngle)
+/**
+ * @brief  按指定填充规则填充多边形 (边表 + 活动边表扫描线算法)
+ * @param  htft TFT句柄指针
+ * @param  points 多边形顶点坐标数组
+ * @param  numPoints 顶点数量
+ * @param  rule 填充规则 (TFT_FILL_EVEN_ODD / TFT_FILL_NONZERO)
+ * @param  color 填充颜色
+ * @retval 无
+ * @note   支持凹多边形和自交多边形。顶点行和列的归属都采用左闭右开 (上闭下开) 规则，
+ *         共用一条边的相邻多边形既不留缝也不重复绘制。
+ */
+void TFT_Fill_Polygon_Rule(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_t numPoints, TFT_Fill_Rule rule, uint16_t color)
+{
+	TFT_Edge_Table table;
+
+	if (numPoints < 3 || points == NULL)
+		return;
+
+	if (!TFT_Edge_Table_Init(&table, numPoints))
+		return; // 内存不足
+
+	// 依次连接相邻顶点，最后一条边闭合多边形
+	const TFT_Point *prev = &points[numPoints - 1];
+	for (uint16_t i = 0; i < numPoints; i++)
 	{
-		endAngle += 360;
+		TFT_Edge_Table_Add(&table, (int32_t)prev->x << 4, (int32_t)prev->y << 4,
+						   (int32_t)points[i].x << 4, (int32_t)points[i].y << 4);
+		prev = &points[i];
 	}
 
-	// 计算弧长确定采样点数量，每2度一个点
-	uint16_t segments = (endAngle - startAngle) / 2;
-	if (segments < 1)
-		segments = 1; // 至少绘制一段
+	TFT_Edge_Table_Fill(htft, &table, rule, color);
+	TFT_Edge_Table_Free(&table);
+}
+
+//----------------- 粗线与折线 -----------------
+
+#define TFT_MITER_LIMIT 4	  // 尖角顶点到拐点的距离超过 线宽一半 * 此值 时退化为斜角
+#define TFT_DISC_SEGMENTS_MAX 32 // 圆头/圆角多边形近似的最大边数
+
+/**
+ * @brief  整数平方根 (逐位试商)
+ * @param  value 被开方数
+ * @retval floor(sqrt(value))
+ */
+static uint32_t TFT_Isqrt(uint32_t value)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+
+	while (bit > value)
+		bit >>= 2;
 
-	float angleStep = (endAngle - startAngle) * 0.0174532925f / segments; // 弧度步长
-	float currentAngle = startAngle * 0.0174532925f;					  // 转换为弧度
+	while (bit != 0)
+	{
+		if (value >= root + bit)
+		{
+			value -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return root;
+}
 
-	// 绘制弧的第一个点
-	uint16_t lastX = centerX + (uint16_t)(radius * cos(currentAngle));
-	uint16_t lastY = centerY + (uint16_t)(radius * sin(currentAngle));
-	TFT_Draw_Point(htft, lastX, lastY, color);
+/**
+ * @brief  向边表加入一个闭合轮廓，并统一为同一环绕方向 (内部辅助函数)
+ * @param  table 边表
+ * @param  contour 轮廓顶点数组 (Q4 定点，[i][0]=x, [i][1]=y)
+ * @param  count 顶点数量
+ * @retval 无
+ * @note   所有轮廓方向一致时，按非零规则填充得到它们的并集，重叠处只输出一次。
+ *         面积为 0 的退化轮廓被忽略。
+ */
+static void TFT_Edge_Table_Add_Contour(TFT_Edge_Table *table, const int32_t contour[][2], uint8_t count)
+{
+	int64_t area = 0;
+	uint8_t i;
 
-	// 逐段计算并绘制弧线
-	for (uint16_t i = 1; i <= segments; i++)
+	for (i = 0; i < count; i++)
 	{
-		currentAngle += angleStep;
-		uint16_t x = centerX + (uint16_t)(radius * cos(currentAngle));
-		uint16_t y = centerY + (uint16_t)(radius * sin(currentAngle));
+		const int32_t *a = contour[i];
+		const int32_t *b = contour[(i + 1) % count];
+		area += (int64_t)a[0] * b[1] - (int64_t)b[0] * a[1];
+	}
+	if (area == 0)
+		return;
 
-		// 绘制当前线段
-		TFT_Draw_Line(htft, lastX, lastY, x, y, color);
+	for (i = 0; i < count; i++)
+	{
+		const int32_t *a = contour[i];
+		const int32_t *b = contour[(i + 1) % count];
+		if (area > 0)
+			TFT_Edge_Table_Add(table, a[0], a[1], b[0], b[1]);
+		else
+			TFT_Edge_Table_Add(table, b[0], b[1], a[0], a[1]);
+	}
+}
+
+/**
+ * @brief  计算圆头/圆角近似多边形的边数 (内部辅助函数)
+ * @param  radius 半径 (Q4 定点)
+ * @retval 边数，半径越大边数越多
+ */
+static uint8_t TFT_Disc_Segments(int32_t radius)
+{
+	int32_t segments = 8 + (radius >> 5); // 8 + 半径像素数 / 2
+	return (segments > TFT_DISC_SEGMENTS_MAX) ? TFT_DISC_SEGMENTS_MAX : (uint8_t)segments;
+}
+
+/**
+ * @brief  向边表加入一个正多边形近似的圆 (内部辅助函数)
+ * @param  table 边表
+ * @param  cx, cy 圆心 (Q4 定点)
+ * @param  radius 半径 (Q4 定点)
+ * @param  segments 边数 (不超过 TFT_DISC_SEGMENTS_MAX)
+ * @retval 无
+ */
+static void TFT_Edge_Table_Add_Disc(TFT_Edge_Table *table, int32_t cx, int32_t cy, int32_t radius, uint8_t segments)
+{
+	int32_t contour[TFT_DISC_SEGMENTS_MAX][2];
+
+	for (uint8_t i = 0; i < segments; i++)
+	{
+		int16_t angle = (int16_t)((uint16_t)i * 360 / segments);
+		contour[i][0] = cx + ((radius * TFT_Cos(angle)) >> 15);
+		contour[i][1] = cy + ((radius * TFT_Sin(angle)) >> 15);
+	}
+	TFT_Edge_Table_Add_Contour(table, contour, segments);
+}
+
+/**
+ * @brief  计算线段的半线宽法向量 (内部辅助函数)
+ * @param  dx, dy 线段方向 (Q4 定点，不能同时为 0)
+ * @param  halfWidth 线宽的一半 (Q4 定点)
+ * @param  nx, ny 输出法向量 (Q4 定点，长度约为 halfWidth)
+ * @retval 无
+ */
+static void TFT_Segment_Normal(int32_t dx, int32_t dy, int32_t halfWidth, int32_t *nx, int32_t *ny)
+{
+	uint32_t adx = (uint32_t)abs(dx);
+	uint32_t ady = (uint32_t)abs(dy);
+	int32_t length;
+
+	// 平方和超出 32 位时降到整像素精度再开方
+	if (adx < 0x8000 && ady < 0x8000)
+		length = (int32_t)TFT_Isqrt(adx * adx + ady * ady);
+	else
+		length = (int32_t)TFT_Isqrt((adx >> 4) * (adx >> 4) + (ady >> 4) * (ady >> 4)) << 4;
+
+	*nx = (int32_t)((int64_t)-dy * halfWidth / length);
+	*ny = (int32_t)((int64_t)dx * halfWidth / length);
+}
+
+/**
+ * @brief  向边表加入折线拐角 (内部辅助函数)
+ * @param  table 边表
+ * @param  x, y 拐点 (Q4 定点)
+ * @param  prevNx, prevNy 前一段的法向量
+ * @param  nextNx, nextNy 后一段的法向量
+ * @param  nextDx, nextDy 后一段的方向
+ * @param  halfWidth 线宽的一半 (Q4 定点)
+ * @param  join 拐角连接方式
+ * @retval 无
+ * @note   只在拐角外侧补形状，内侧已被两段线段的矩形覆盖。
+ */
+static void TFT_Edge_Table_Add_Join(TFT_Edge_Table *table, int32_t x, int32_t y,
+									int32_t prevNx, int32_t prevNy, int32_t nextNx, int32_t nextNy,
+									int32_t nextDx, int32_t nextDy, int32_t halfWidth, TFT_Line_Join join)
+{
+	int32_t contour[4][2];
+	uint8_t count = 0;
+
+	if (join == TFT_JOIN_ROUND)
+	{
+		TFT_Edge_Table_Add_Disc(table, x, y, halfWidth, TFT_Disc_Segments(halfWidth));
+		return;
+	}
+
+	// 外侧是前一段法向量与后一段前进方向相背的一侧
+	if ((int64_t)prevNx * nextDx + (int64_t)prevNy * nextDy > 0)
+	{
+		prevNx = -prevNx, prevNy = -prevNy;
+		nextNx = -nextNx, nextNy = -nextNy;
+	}
+
+	contour[count][0] = x;
+	contour[count++][1] = y;
+	contour[count][0] = x + prevNx;
+	contour[count++][1] = y + prevNy;
+
+	if (join == TFT_JOIN_MITER)
+	{
+		// 尖角顶点 = 拐点 + m * |n|^2 / (m . n_prev)，其中 m = n_prev + n_next
+		int32_t mx = prevNx + nextNx;
+		int32_t my = prevNy + nextNy;
+		int64_t normalSq = (int64_t)prevNx * prevNx + (int64_t)prevNy * prevNy;
+		int64_t denom = normalSq + (int64_t)prevNx * nextNx + (int64_t)prevNy * nextNy;
+		int64_t miterSq = (int64_t)mx * mx + (int64_t)my * my;
+
+		// |尖角| <= LIMIT * |n|  <=>  |m|^2 * |n|^2 <= LIMIT^2 * denom^2
+		if (denom > 0 && miterSq * normalSq <= (int64_t)TFT_MITER_LIMIT * TFT_MITER_LIMIT * denom * denom)
+		{
+			contour[count][0] = x + (int32_t)(mx * normalSq / denom);
+			contour[count++][1] = y + (int32_t)(my * normalSq / denom);
+		}
+	}
+
+	contour[count][0] = x + nextNx;
+	contour[count++][1] = y + nextNy;
+	TFT_Edge_Table_Add_Contour(table, contour, count);
+}
+
+/**
+ * @brief  绘制粗直线
+ * @param  htft TFT句柄指针
+ * @param  x1, y1 起点坐标
+ * @param  x2, y2 终点坐标
+ * @param  width 线宽 (像素)
+ * @param  cap 端点样式
+ * @param  color 线条颜色
+ * @retval 无
+ */
+void TFT_Draw_Thick_Line(TFT_HandleTypeDef *htft, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+						 uint16_t width, TFT_Line_Cap cap, uint16_t color)
+{
+	TFT_Point points[2] = {{x1, y1}, {x2, y2}};
+	TFT_Draw_Polyline(htft, points, 2, width, TFT_JOIN_BEVEL, cap, color);
+}
+
+/**
+ * @brief  绘制粗折线
+ * @param  htft TFT句柄指针
+ * @param  points 折线顶点坐标数组
+ * @param  numPoints 顶点数量
+ * @param  width 线宽 (像素)
+ * @param  join 拐角连接方式
+ * @param  cap 端点样式
+ * @param  color 线条颜色
+ * @retval 无
+ * @note   每段线段是以中心线为轴、宽为 width 的矩形，拐角和端点补上对应形状，
+ *         全部轮廓统一方向后放入一张边表，按非零规则填充。重复的相邻顶点会被跳过。
+ */
+void TFT_Draw_Polyline(TFT_HandleTypeDef *htft, const TFT_Point points[], uint16_t numPoints,
+					   uint16_t width, TFT_Line_Join join, TFT_Line_Cap cap, uint16_t color)
+{
+	if (points == NULL || numPoints < 2 || width == 0)
+		return;
+
+	// 1 像素线宽直接使用 Bresenham 直线
+	if (width == 1)
+	{
+		for (uint16_t i = 1; i < numPoints; i++)
+		{
+			TFT_Draw_Line(htft, points[i - 1].x, points[i - 1].y, points[i].x, points[i].y, color);
+		}
+		return;
+	}
+
+	int32_t halfWidth = (int32_t)width << 3; // 线宽的一半 (Q4)
+	uint8_t discSegments = TFT_Disc_Segments(halfWidth);
+
+	// 边数上限: 每段 4 条，每个拐角至多 4 条 (圆角为圆的边数)，每个圆头为圆的边数
+	uint32_t capacity = (uint32_t)(numPoints - 1) * 4;
+	capacity += (uint32_t)(numPoints - 2) * ((join == TFT_JOIN_ROUND) ? discSegments : 4);
+	capacity += (cap == TFT_CAP_ROUND) ? 2u * discSegments : 0;
+	if (capacity > 0xFFFF)
+		return;
+
+	TFT_Edge_Table table;
+	if (!TFT_Edge_Table_Init(&table, (uint16_t)capacity))
+		return; // 内存不足
+
+	int32_t prevNx = 0, prevNy = 0;
+	int32_t lastX = (int32_t)points[0].x << 4;
+	int32_t lastY = (int32_t)points[0].y << 4;
+	uint8_t hasSegment = 0;
+
+	for (uint16_t i = 1; i < numPoints; i++)
+	{
+		int32_t x0 = (int32_t)points[i - 1].x << 4;
+		int32_t y0 = (int32_t)points[i - 1].y << 4;
+		int32_t x1 = (int32_t)points[i].x << 4;
+		int32_t y1 = (int32_t)points[i].y << 4;
+		int32_t dx = x1 - x0;
+		int32_t dy = y1 - y0;
+		int32_t nx, ny;
+
+		if (dx == 0 && dy == 0)
+			continue; // 重复顶点
+
+		TFT_Segment_Normal(dx, dy, halfWidth, &nx, &ny);
+
+		int32_t quad[4][2] = {{x0 + nx, y0 + ny}, {x1 + nx, y1 + ny}, {x1 - nx, y1 - ny}, {x0 - nx, y0 - ny}};
+		TFT_Edge_Table_Add_Contour(&table, quad, 4);
+
+		if (hasSegment)
+			TFT_Edge_Table_Add_Join(&table, x0, y0, prevNx, prevNy, nx, ny, dx, dy, halfWidth, join);
+		else if (cap == TFT_CAP_ROUND)
+			TFT_Edge_Table_Add_Disc(&table, x0, y0, halfWidth, discSegments); // 起点圆头
+
+		prevNx = nx;
+		prevNy = ny;
+		lastX = x1;
+		lastY = y1;
+		hasSegment = 1;
+	}
+
+	// 终点圆头 (所有顶点重合时只画一个圆点)
+	if (cap == TFT_CAP_ROUND)
+		TFT_Edge_Table_Add_Disc(&table, lastX, lastY, halfWidth, discSegments);
+
+	TFT_Edge_Table_Fill(htft, &table, TFT_FILL_NONZERO, color);
+	TFT_Edge_Table_Free(&table);
+}
 
-		lastX = x;
-		lastY = y;
+/**
+ * @brief  判断相对圆心的偏移 (dx, dy) 是否落在扇区角度范围内 (内部辅助函数)
+ * @param  dx, dy 像素相对圆心的偏移
+ * @param  sx, sy 起始角方向向量 (Q15)
+ * @param  ex, ey 结束角方向向量 (Q15)
+ * @param  sweep  扇区张角 (0-360度)
+ * @retval 1=在范围内, 0=不在
+ * @note   只使用叉积/点积的符号，没有除法和三角函数。
+ */
+static uint8_t TFT_Angle_In_Sweep(int32_t dx, int32_t dy, int32_t sx, int32_t sy, int32_t ex, int32_t ey, uint16_t sweep)
+{
+	if (sweep >= 360)
+		return 1;
+
+	if (sweep <= 180)
+	{
+		// 位于起始边的逆时针侧 (屏幕坐标下角度增大一侧) 且位于结束边之前
+		if (sx * dy - sy * dx < 0)
+			return 0;
+		if (dx * ey - dy * ex < 0)
+			return 0;
+		// 张角很小时排除与起始方向相反的共线点
+		if (sweep < 90 && sx * dx + sy * dy < 0)
+			return 0;
+		return 1;
 	}
+
+	// 张角大于 180 度: 取补扇区 (end -> start) 的严格内部之外的部分
+	return !((ex * dy - ey * dx > 0) && (dx * sy - dy * sx > 0));
+}
+
+/**
+ * @brief  绘制圆弧 (中点画圆法 + 整数角度判断)
+ * @param  htft TFT句柄指针
+ * @param  centerX, centerY 圆心坐标
+ * @param  radius 圆弧半径
+ * @param  startAngle 起始角度(0-360度)
+ * @param  endAngle 结束角度(0-360度)
+ * @param  color 圆弧颜色
+ * @retval 无
+ * @note   角度以 X 轴正方向为 0 度，顺时针 (屏幕 Y 轴向下) 增大。
+ *         startAngle 与 endAngle 对 360 取模后相等但原值不同 (如 0 与 360) 时绘制整圆。
+ */
+void TFT_Draw_Arc(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint8_t radius,
+				  uint16_t startAngle, uint16_t endAngle, uint16_t color)
+{
+	uint16_t start = startAngle % 360;
+	uint16_t end = endAngle % 360;
+	uint16_t sweep;
+
+	// 确保终止角度大于起始角度
+	if (end < start)
+	{
+		end += 360;
+	}
+	sweep = end - start;
+	if (sweep == 0 && startAngle != endAngle)
+	{
+		sweep = 360; // 例如 0 ~ 360 度: 整圆
+	}
+
+	// 起止方向向量 (Q15)
+	int32_t sx = TFT_Cos(start);
+	int32_t sy = TFT_Sin(start);
+	int32_t ex = TFT_Cos(end);
+	int32_t ey = TFT_Sin(end);
+
+	int16_t plotX = 0;						   // 相对于圆心的 x 坐标
+	int16_t plotY = radius;					   // 相对于圆心的 y 坐标
+	int16_t decisionParam = 3 - (radius << 1); // 初始决策参数: 3 - 2*r
+	TFT_Point arcPoints[8];					   // 当前步通过角度判断的对称点
+	uint8_t count, offsetCount, i;
+
+	while (1)
+	{
+		// 八个对称点；位于坐标轴 (x=0) 或对角线 (x=y) 上时只有前 4 个点不重复
+		int16_t offsets[8][2] = {{plotX, plotY}, {plotY, -plotX}, {-plotX, -plotY}, {-plotY, plotX},
+								 {-plotX, plotY}, {plotY, plotX}, {plotX, -plotY}, {-plotY, -plotX}};
+		offsetCount = (plotX != 0 && plotX != plotY) ? 8 : 4;
+
+		count = 0;
+		for (i = 0; i < offsetCount; i++)
+		{
+			int32_t px = (int32_t)centerX + offsets[i][0];
+			int32_t py = (int32_t)centerY + offsets[i][1];
+			if (px < 0 || py < 0)
+				continue; // 超出屏幕左/上边界
+			if (TFT_Angle_In_Sweep(offsets[i][0], offsets[i][1], sx, sy, ex, ey, sweep))
+			{
+				arcPoints[count++] = (TFT_Point){px, py};
+			}
+		}
+		if (count > 0)
+		{
+			TFT_Draw_MultiPoint(htft, arcPoints, count, color);
+		}
+
+		if (plotX >= plotY)
+			break;
+
+		plotX++; // x 增加 1
+		if (decisionParam < 0)
+		{
+			decisionParam += (plotX << 2) + 6;
+		}
+		else
+		{
+			plotY--; // y 减小 1
+			decisionParam += (plotX - plotY) * 4 + 10; // 4*(plotX - plotY) + 10 (差为负数)
+		}
+		if (plotX > plotY)
+			break;
+	}
+}
+
+//----------------- 扇形、圆环段填充 -----------------
+
+#define TFT_SECTOR_PIECES_MAX 4 // 扫掠角按不超过 90 度拆分后的最大分段数
+
+/**
+ * @brief  向下取整的整数除法 (内部辅助函数)
+ * @param  numerator 被除数
+ * @param  denominator 除数 (必须大于 0)
+ * @retval floor(numerator / denominator)
+ */
+static int32_t TFT_Floor_Div(int32_t numerator, int32_t denominator)
+{
+	int32_t q = numerator / denominator;
+	if (q * denominator > numerator)
+		q--;
+	return q;
+}
+
+/**
+ * @brief  计算扇形分段在某一行上的列范围 (内部辅助函数)
+ * @param  ax, ay 分段起始边方向 (Q15)
+ * @param  bx, by 分段结束边方向 (Q15)
+ * @param  dy 行相对圆心的偏移
+ * @param  lo, hi 输出列范围 (相对圆心，闭区间)
+ * @retval 1=该行有可能的像素, 0=该行为空
+ * @note   分段扫掠角小于 180 度，像素 p 属于分段当且仅当
+ *         cross(a, p) >= 0 且 cross(p, b) > 0，即起始边包含、结束边不包含。
+ *         相邻分段使用相同的边方向，公共边上的像素恰好只属于其中一个。
+ */
+static uint8_t TFT_Sector_Row_Range(int32_t ax, int32_t ay, int32_t bx, int32_t by, int32_t dy, int32_t *lo, int32_t *hi)
+{
+	*lo = INT32_MIN;
+	*hi = INT32_MAX;
+
+	// cross(a, p) = ax*dy - ay*dx >= 0
+	if (ay > 0)
+		*hi = TFT_Floor_Div(ax * dy, ay);
+	else if (ay < 0)
+		*lo = -TFT_Floor_Div(ax * dy, -ay);
+	else if (ax * dy < 0)
+		return 0;
+
+	// cross(p, b) = dx*by - dy*bx > 0
+	if (by > 0)
+	{
+		int32_t bound = TFT_Floor_Div(dy * bx, by) + 1;
+		if (bound > *lo)
+			*lo = bound;
+	}
+	else if (by < 0)
+	{
+		int32_t bound = -TFT_Floor_Div(dy * bx, -by) - 1; // ceil(dy*bx/by) - 1
+		if (bound < *hi)
+			*hi = bound;
+	}
+	else if (dy * bx >= 0)
+	{
+		return 0;
+	}
+
+	return (*lo <= *hi);
+}
+
+/**
+ * @brief  填充圆环扇区 (内部实现)
+ * @param  htft TFT句柄指针
+ * @param  centerX, centerY 圆心坐标
+ * @param  outerRadius 外半径
+ * @param  innerRadius 内半径 (0 表示实心扇形)
+ * @param  startAngle 起始角度 (度，任意整数)
+ * @param  sweep 扫掠角度 (度，顺时针，>= 360 表示整个圆环)
+ * @param  color 填充颜色
+ * @retval 无
+ * @note   像素属于区间 [startAngle, startAngle + sweep)，因此相邻扇区拼接时既无缝隙也不重叠。
+ *         扫掠角拆成不超过 90 度的分段，每行对每个分段求两个半平面约束得到列范围，
+ *         再与圆环在该行的左右两段相交，排序合并后作为水平线段输出。
+ */
+static void TFT_Fill_Sector(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint16_t outerRadius,
+							uint16_t innerRadius, int16_t startAngle, uint16_t sweep, uint16_t color)
+{
+	int32_t pieceVec[TFT_SECTOR_PIECES_MAX + 1][2];
+	uint8_t pieceCount;
+	uint8_t fullRing = (sweep >= 360);
+	TFT_Span_Sink sink;
+
+	if (sweep == 0 || innerRadius > outerRadius)
+		return;
+
+	// 扇区分段的边方向
+	if (!fullRing)
+	{
+		pieceCount = (uint8_t)((sweep + 89) / 90);
+		for (uint8_t i = 0; i <= pieceCount; i++)
+		{
+			int16_t angle = (int16_t)(startAngle % 360 + (int32_t)sweep * i / pieceCount);
+			pieceVec[i][0] = TFT_Cos(angle);
+			pieceVec[i][1] = TFT_Sin(angle);
+		}
+	}
+	else
+	{
+		pieceCount = 0;
+	}
+
+	uint32_t outerSq = (uint32_t)outerRadius * outerRadius + outerRadius;
+	uint32_t innerSq = (uint32_t)innerRadius * innerRadius;
+
+	TFT_Span_Begin(&sink, htft, color);
+
+	for (int32_t dy = -(int32_t)outerRadius; dy <= (int32_t)outerRadius; dy++)
+	{
+		uint32_t dySq = (uint32_t)(dy * dy);
+		if (dySq > outerSq)
+			continue;
+
+		// 圆环在本行的部分: [-xo, -xi-1] 和 [xi+1, xo]，xi < 0 时合为一段
+		int32_t xo = (int32_t)TFT_Isqrt(outerSq - dySq);
+		int32_t xi = (dySq + 1 <= innerSq) ? (int32_t)TFT_Isqrt(innerSq - dySq - 1) : -1;
+		int32_t ring[2][2];
+		uint8_t ringCount;
+
+		if (xi < 0)
+		{
+			ring[0][0] = -xo, ring[0][1] = xo;
+			ringCount = 1;
+		}
+		else
+		{
+			ring[0][0] = -xo, ring[0][1] = -xi - 1;
+			ring[1][0] = xi + 1, ring[1][1] = xo;
+			ringCount = 2;
+		}
+
+		// 与各分段相交，得到本行所有线段 (按列排序后合并)
+		int32_t spans[2 * TFT_SECTOR_PIECES_MAX + 1][2];
+		uint8_t spanCount = 0;
+
+		for (uint8_t r = 0; r < ringCount; r++)
+		{
+			if (fullRing)
+			{
+				spans[spanCount][0] = ring[r][0];
+				spans[spanCount++][1] = ring[r][1];
+				continue;
+			}
+			for (uint8_t p = 0; p < pieceCount; p++)
+			{
+				int32_t lo, hi;
+				if (!TFT_Sector_Row_Range(pieceVec[p][0], pieceVec[p][1], pieceVec[p + 1][0], pieceVec[p + 1][1], dy, &lo, &hi))
+					continue;
+				if (lo < ring[r][0])
+					lo = ring[r][0];
+				if (hi > ring[r][1])
+					hi = ring[r][1];
+				if (lo <= hi)
+				{
+					spans[spanCount][0] = lo;
+					spans[spanCount++][1] = hi;
+				}
+			}
+		}
+
+		// 实心扇形的圆心像素不满足严格的结束边条件，单独归入扇形
+		if (!fullRing && innerRadius == 0 && dy == 0)
+		{
+			spans[spanCount][0] = 0;
+			spans[spanCount++][1] = 0;
+		}
+
+		// 插入排序 + 合并相接或重叠的线段
+		for (uint8_t i = 1; i < spanCount; i++)
+		{
+			int32_t lo = spans[i][0], hi = spans[i][1];
+			uint8_t j = i;
+			while (j > 0 && spans[j - 1][0] > lo)
+			{
+				spans[j][0] = spans[j - 1][0];
+				spans[j][1] = spans[j - 1][1];
+				j--;
+			}
+			spans[j][0] = lo;
+			spans[j][1] = hi;
+		}
+		for (uint8_t i = 0; i < spanCount;)
+		{
+			int32_t lo = spans[i][0], hi = spans[i][1];
+			for (i++; i < spanCount && spans[i][0] <= hi + 1; i++)
+			{
+				if (spans[i][1] > hi)
+					hi = spans[i][1];
+			}
+			TFT_Span_Add(&sink, (int16_t)(centerX + lo), (int16_t)(centerY + dy), (int16_t)(hi - lo + 1));
+		}
+	}
+
+	TFT_Span_End(&sink);
+}
+
+/**
+ * @brief  填充圆环扇区 (圆环段)
+ * @param  htft TFT句柄指针
+ * @param  centerX, centerY 圆心坐标
+ * @param  outerRadius 外半径
+ * @param  innerRadius 内半径 (0 表示实心扇形)
+ * @param  startAngle 起始角度 (0-360度)
+ * @param  endAngle 结束角度 (0-360度)
+ * @param  color 填充颜色
+ * @retval 无
+ */
+void TFT_Fill_Arc(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint16_t outerRadius,
+				  uint16_t innerRadius, uint16_t startAngle, uint16_t endAngle, uint16_t color)
+{
+	uint16_t start = startAngle % 360;
+	uint16_t sweep = (uint16_t)((endAngle % 360 + 360 - start) % 360);
+
+	if (sweep == 0)
+		sweep = 360; // 起止角度相同表示整圆
+
+	TFT_Fill_Sector(htft, centerX, centerY, outerRadius, innerRadius, (int16_t)start, sweep, color);
+}
+
+/**
+ * @brief  填充扇形 (饼图切片)
+ * @param  htft TFT句柄指针
+ * @param  centerX, centerY 圆心坐标
+ * @param  radius 半径
+ * @param  startAngle 起始角度 (0-360度)
+ * @param  endAngle 结束角度 (0-360度)
+ * @param  color 填充颜色
+ * @retval 无
+ */
+void TFT_Fill_Pie(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint16_t radius,
+				  uint16_t startAngle, uint16_t endAngle, uint16_t color)
+{
+	TFT_Fill_Arc(htft, centerX, centerY, radius, 0, startAngle, endAngle, color);
+}
+
+/**
+ * @brief  增量更新圆环仪表
+ * @param  htft TFT句柄指针
+ * @param  centerX, centerY 圆心坐标
+ * @param  outerRadius 外半径
+ * @param  innerRadius 内半径
+ * @param  oldAngle 上一次指示值对应的角度 (度)
+ * @param  newAngle 新指示值对应的角度 (度)
+ * @param  color 指示部分颜色
+ * @param  bgColor 未指示部分 (轨道) 颜色
+ * @retval 无
+ */
+void TFT_Update_Arc_Gauge(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY, uint16_t outerRadius,
+						  uint16_t innerRadius, int16_t oldAngle, int16_t newAngle, uint16_t color, uint16_t bgColor)
+{
+	if (newAngle > oldAngle)
+		TFT_Fill_Sector(htft, centerX, centerY, outerRadius, innerRadius, oldAngle, (uint16_t)(newAngle - oldAngle), color);
+	else if (newAngle < oldAngle)
+		TFT_Fill_Sector(htft, centerX, centerY, outerRadius, innerRadius, newAngle, (uint16_t)(oldAngle - newAngle), bgColor);
+}
+
+//----------------- 批量矩形 -----------------
+
+/**
+ * @brief  判断两个矩形是否重叠 (内部辅助函数)
+ * @param  a, b 矩形
+ * @retval 1=重叠, 0=不重叠
+ */
+static uint8_t TFT_Rect_Overlap(const TFT_Rect *a, const TFT_Rect *b)
+{
+	return (uint32_t)a->x < (uint32_t)b->x + b->width && (uint32_t)b->x < (uint32_t)a->x + a->width &&
+		   (uint32_t)a->y < (uint32_t)b->y + b->height && (uint32_t)b->y < (uint32_t)a->y + a->height;
+}
+
+#define TFT_RECTS_CHUNK 32 // 批量矩形每组处理的数量 (与分组位掩码的位数相同)
+
+/**
+ * @brief  批量填充矩形
+ * @param  htft TFT句柄指针
+ * @param  rects 矩形数组
+ * @param  colors 颜色数组 (与 rects 一一对应)
+ * @param  count 矩形数量
+ * @retval 无
+ * @note   按顺序每 TFT_RECTS_CHUNK 个矩形一组，用 32 位掩码记录组内已发送的矩形。
+ *         每发送一个矩形后，把组内后面同色且与中间尚未发送的矩形都不重叠的矩形提前发送，
+ *         重叠矩形之间的先后顺序保持不变，最终画面与逐个按顺序填充相同。
+ *         同色矩形连续发送时预填充的半区可直接复用；换色时只有新颜色填入空闲半区这一步
+ *         与上一块 DMA 传输并行，设置窗口 (TFT_Set_Address) 仍会等待上一块传输完成。
+ */
+void TFT_Fill_Rects(TFT_HandleTypeDef *htft, const TFT_Rect rects[], const uint16_t colors[], uint16_t count)
+{
+	uint16_t base, n, i, j, k;
+
+	if (rects == NULL || colors == NULL || count == 0)
+		return;
+
+	for (base = 0; base < count; base += n)
+	{
+		const TFT_Rect *r = &rects[base];
+		const uint16_t *c = &colors[base];
+		uint32_t done = 0; // 第 i 位为 1: 组内第 i 个矩形已发送
+
+		n = count - base < TFT_RECTS_CHUNK ? count - base : TFT_RECTS_CHUNK;
+		for (i = 0; i < n; i++)
+		{
+			if (done & (1UL << i))
+				continue;
+
+			TFT_Fill_Area(htft, r[i].x, r[i].y, r[i].x + r[i].width, r[i].y + r[i].height, c[i]);
+			done |= 1UL << i;
+			for (j = i + 1; j < n; j++)
+			{
+				if ((done & (1UL << j)) || c[j] != c[i] || r[j].width == 0 || r[j].height == 0)
+					continue;
+
+				// 只有不与中间尚未发送的矩形重叠时才能提前
+				for (k = i + 1; k < j; k++)
+				{
+					if (!(done & (1UL << k)) && TFT_Rect_Overlap(&r[j], &r[k]))
+						break;
+				}
+				if (k < j)
+					continue;
+
+				TFT_Fill_Area(htft, r[j].x, r[j].y, r[j].x + r[j].width, r[j].y + r[j].height, c[j]);
+				done |= 1UL << j;
+			}
+		}
+	}
+}
+
+/**
+ * @brief  批量绘制矩形边框
+ * @param  htft TFT句柄指针
+ * @param  rects 矩形数组
+ * @param  colors 颜色数组 (与 rects 一一对应)
+ * @param  count 矩形数量
+ * @retval 无
+ * @note   每个边框拆成上、下、左、右四条互不重叠的纯色矩形，放入栈上的数组，
+ *         每攒满 TFT_RECTS_CHUNK 条按批量填充发送一次。
+ */
+void TFT_Draw_Rects(TFT_HandleTypeDef *htft, const TFT_Rect rects[], const uint16_t colors[], uint16_t count)
+{
+	TFT_Rect edges[TFT_RECTS_CHUNK];
+	uint16_t edgeColors[TFT_RECTS_CHUNK];
+	uint16_t edgeCount = 0;
+
+	if (rects == NULL || colors == NULL || count == 0)
+		return;
+
+	for (uint16_t i = 0; i < count; i++)
+	{
+		const TFT_Rect *r = &rects[i];
+		if (r->width == 0 || r->height == 0)
+			continue;
+
+		// 放不下一个边框的四条边时先发送已有的边
+		if (edgeCount > TFT_RECTS_CHUNK - 4)
+		{
+			TFT_Fill_Rects(htft, edges, edgeColors, edgeCount);
+			edgeCount = 0;
+		}
+
+		// 上边 (含两角)
+		edges[edgeCount] = (TFT_Rect){r->x, r->y, r->width, 1};
+		edgeColors[edgeCount++] = colors[i];
+		if (r->height > 1)
+		{
+			// 下边 (含两角)
+			edges[edgeCount] = (TFT_Rect){r->x, (uint16_t)(r->y + r->height - 1), r->width, 1};
+			edgeColors[edgeCount++] = colors[i];
+		}
+		if (r->height > 2)
+		{
+			// 左右两边 (不含角)
+			edges[edgeCount] = (TFT_Rect){r->x, (uint16_t)(r->y + 1), 1, (uint16_t)(r->height - 2)};
+			edgeColors[edgeCount++] = colors[i];
+			if (r->width > 1)
+			{
+				edges[edgeCount] = (TFT_Rect){(uint16_t)(r->x + r->width - 1), (uint16_t)(r->y + 1), 1, (uint16_t)(r->height - 2)};
+				edgeColors[edgeCount++] = colors[i];
+			}
+		}
+	}
+
+	if (edgeCount > 0)
+		TFT_Fill_Rects(htft, edges, edgeColors, edgeCount);
+}
+
+/**
+ * @brief  矩形 a 减去其中的矩形 b，得到至多 4 条互不重叠的矩形 (内部辅助函数)
+ * @param  a 被减矩形
+ * @param  b 完全位于 a 内的矩形
+ * @param  out 输出数组 (至少 4 个元素)
+ * @retval 输出的矩形数量
+ * @note   上、下两条取 a 的全宽，左、右两条只取 b 所在的行。
+ */
+static uint16_t TFT_Rect_Subtract(const TFT_Rect *a, const TFT_Rect *b, TFT_Rect out[])
+{
+	uint16_t n = 0;
+
+	if (b->y > a->y) // 上
+		out[n++] = (TFT_Rect){a->x, a->y, a->width, (uint16_t)(b->y - a->y)};
+	if (b->y + b->height < a->y + a->height) // 下
+		out[n++] = (TFT_Rect){a->x, (uint16_t)(b->y + b->height), a->width, (uint16_t)(a->y + a->height - b->y - b->height)};
+	if (b->x > a->x) // 左
+		out[n++] = (TFT_Rect){a->x, b->y, (uint16_t)(b->x - a->x), b->height};
+	if (b->x + b->width < a->x + a->width) // 右
+		out[n++] = (TFT_Rect){(uint16_t)(b->x + b->width), b->y, (uint16_t)(a->x + a->width - b->x - b->width), b->height};
+	return n;
+}
+
+/**
+ * @brief  移动纯色矩形 (只重绘变化的部分)
+ * @param  htft TFT句柄指针
+ * @param  oldRect 原来的位置和尺寸
+ * @param  newRect 新的位置和尺寸
+ * @param  color 矩形颜色
+ * @param  bgColor 背景颜色
+ * @retval 无
+ * @note   新旧矩形重叠时，重叠部分颜色不变，不再发送: 只有旧矩形露出的部分用 bgColor 填充、
+ *         新矩形新覆盖的部分用 color 填充 (各至多 4 条)，例如 60x60 的方块移动 3 像素只需发送
+ *         两条 3x60 的矩形。不重叠时相当于擦除旧矩形再填充新矩形。
+ */
+void TFT_Move_Rect(TFT_HandleTypeDef *htft, const TFT_Rect *oldRect, const TFT_Rect *newRect, uint16_t color, uint16_t bgColor)
+{
+	TFT_Rect strips[8];
+	uint16_t colors[8];
+	uint16_t n = 0, k;
+
+	if (oldRect == NULL || newRect == NULL)
+		return;
+
+	if (TFT_Rect_Overlap(oldRect, newRect))
+	{
+		// 重叠部分
+		uint16_t x0 = oldRect->x > newRect->x ? oldRect->x : newRect->x;
+		uint16_t y0 = oldRect->y > newRect->y ? oldRect->y : newRect->y;
+		uint32_t x1 = (uint32_t)oldRect->x + oldRect->width < (uint32_t)newRect->x + newRect->width ? (uint32_t)oldRect->x + oldRect->width : (uint32_t)newRect->x + newRect->width;
+		uint32_t y1 = (uint32_t)oldRect->y + oldRect->height < (uint32_t)newRect->y + newRect->height ? (uint32_t)oldRect->y + oldRect->height : (uint32_t)newRect->y + newRect->height;
+		TFT_Rect common = {x0, y0, (uint16_t)(x1 - x0), (uint16_t)(y1 - y0)};
+
+		n = TFT_Rect_Subtract(oldRect, &common, strips);
+		for (k = 0; k < n; k++)
+			colors[k] = bgColor;
+		n += TFT_Rect_Subtract(newRect, &common, strips + n);
+		for (; k < n; k++)
+			colors[k] = color;
+	}
+	else
+	{
+		// 不重叠 (包括尺寸为 0): 擦除旧矩形，填充新矩形
+		strips[n] = *oldRect;
+		colors[n++] = bgColor;
+		strips[n] = *newRect;
+		colors[n++] = color;
+	}
+
+	// 旧矩形露出的部分与新矩形互不重叠，按同色批量发送
+	TFT_Fill_Rects(htft, strips, colors, n);
+}
+
+//----------------- 渐变填充 -----------------
+
+/**
+ * @brief  4x4 有序抖动 (Bayer) 矩阵
+ */
+static const uint8_t TFT_Bayer_4x4[4][4] = {
+	{0, 8, 2, 10},
+	{12, 4, 14, 6},
+	{3, 11, 1, 9},
+	{15, 7, 13, 5}};
+
+/**
+ * @brief  渐变颜色累加器
+ * @note   三个分量以 RGB565 各通道的量化级为单位，带 8 位小数 (Q8)，
+ *         逐像素加上增量即可得到下一个颜色，量化时的小数部分可用于抖动。
+ */
+typedef struct
+{
+	int32_t r, g, b;
+} TFT_Gradient_Color;
+
+/**
+ * @brief  把 RGB565 颜色展开为 Q8 分量 (内部辅助函数)
+ * @param  color RGB565 颜色
+ * @param  out 输出分量
+ * @retval 无
+ */
+static void TFT_Gradient_Unpack(uint16_t color, TFT_Gradient_Color *out)
+{
+	out->r = (int32_t)(color >> 11) << 8;
+	out->g = (int32_t)((color >> 5) & 0x3F) << 8;
+	out->b = (int32_t)(color & 0x1F) << 8;
+}
+
+/**
+ * @brief  计算两种颜色之间每一步的分量增量 (内部辅助函数)
+ * @param  from, to 起止颜色
+ * @param  steps 步数 (0 时增量为 0)
+ * @param  out 输出增量 (Q8)
+ * @retval 无
+ */
+static void TFT_Gradient_Step(const TFT_Gradient_Color *from, const TFT_Gradient_Color *to, int32_t steps, TFT_Gradient_Color *out)
+{
+	if (steps <= 0)
+	{
+		out->r = out->g = out->b = 0;
+		return;
+	}
+	out->r = (to->r - from->r) / steps;
+	out->g = (to->g - from->g) / steps;
+	out->b = (to->b - from->b) / steps;
+}
+
+/**
+ * @brief  把 Q8 分量量化为 RGB565 (内部辅助函数)
+ * @param  r, g, b Q8 分量
+ * @param  threshold 量化阈值 (0~255，不抖动时为 128 即四舍五入)
+ * @retval RGB565 颜色
+ */
+static inline uint16_t TFT_Gradient_Pack(int32_t r, int32_t g, int32_t b, int32_t threshold)
+{
+	r = (r + threshold) >> 8;
+	g = (g + threshold) >> 8;
+	b = (b + threshold) >> 8;
+	if (r > 31)
+		r = 31;
+	if (g > 63)
+		g = 63;
+	if (b > 31)
+		b = 31;
+	return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+/**
+ * @brief  把一行线性渐变像素直接生成到发送缓冲区 (内部辅助函数)
+ * @param  htft TFT句柄指针
+ * @param  start 行首像素的颜色分量
+ * @param  step 每像素的分量增量
+ * @param  count 像素数
+ * @param  x, y 行首像素的屏幕坐标 (用于选择抖动阈值)
+ * @param  dither 是否启用有序抖动
+ * @retval 无
+ */
+static void TFT_Gradient_Write_Row(TFT_HandleTypeDef *htft, TFT_Gradient_Color start, const TFT_Gradient_Color *step,
+								   uint16_t count, uint16_t x, uint16_t y, uint8_t dither)
+{
+	const uint8_t *bayerRow = TFT_Bayer_4x4[y & 3];
+
+	while (count > 0)
+	{
+		uint16_t length;
+		uint8_t *dst = TFT_Buffer_Reserve(htft, &length);
+		if (dst == NULL)
+			return;
+
+		uint16_t pixels = length >> 1;
+		if (pixels > count)
+			pixels = count;
+
+		for (uint16_t i = 0; i < pixels; i++)
+		{
+			int32_t threshold = dither ? (bayerRow[x & 3] << 4) + 8 : 128;
+			uint16_t color = TFT_Gradient_Pack(start.r, start.g, start.b, threshold);
+			*dst++ = color >> 8;
+			*dst++ = color & 0xFF;
+			start.r += step->r;
+			start.g += step->g;
+			start.b += step->b;
+			x++;
+		}
+
+		TFT_Buffer_Commit(htft, pixels << 1);
+		count -= pixels;
+	}
+}
+
+/**
+ * @brief  在已设置好的窗口内输出若干行线性渐变 (内部辅助函数)
+ * @param  htft TFT句柄指针
+ * @param  x, y 第一行行首的屏幕坐标
+ * @param  width 行宽
+ * @param  rows 行数
+ * @param  rowIndex 第一行在整个渐变中的行序号
+ * @param  colOffset 行首在整个渐变中的列序号
+ * @param  from 渐变起点颜色
+ * @param  step 渐变方向上每像素的增量
+ * @param  direction 渐变方向
+ * @param  dither 是否抖动
+ * @retval 无
+ */
+static void TFT_Gradient_Write_Rows(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint16_t width, uint16_t rows,
+									uint16_t rowIndex, uint16_t colOffset, const TFT_Gradient_Color *from,
+									const TFT_Gradient_Color *step, TFT_Gradient_Direction direction, uint8_t dither)
+{
+	const TFT_Gradient_Color zero = {0, 0, 0};
+
+	for (uint16_t row = 0; row < rows; row++)
+	{
+		TFT_Gradient_Color start = *from;
+		uint16_t along = (direction == TFT_GRADIENT_HORIZONTAL) ? colOffset : (uint16_t)(rowIndex + row);
+
+		start.r += step->r * along;
+		start.g += step->g * along;
+		start.b += step->b * along;
+		TFT_Gradient_Write_Row(htft, start, (direction == TFT_GRADIENT_HORIZONTAL) ? step : &zero,
+							   width, x, (uint16_t)(y + row), dither);
+	}
+}
+
+/**
+ * @brief  填充线性渐变矩形
+ * @param  htft TFT句柄指针
+ * @param  x1, y1 左上角坐标
+ * @param  x2, y2 右下角坐标
+ * @param  color1 起点颜色 (左侧或顶部)
+ * @param  color2 终点颜色 (右侧或底部)
+ * @param  direction 渐变方向
+ * @param  dither 是否启用 4x4 有序抖动 (1=启用)
+ * @retval 无
+ */
+void TFT_Fill_Gradient_Rectangle(TFT_HandleTypeDef *htft, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
+								 uint16_t color1, uint16_t color2, TFT_Gradient_Direction direction, uint8_t dither)
+{
+	TFT_Gradient_Color from, to, step;
+
+	if (x1 > x2 || y1 > y2)
+		return;
+
+	uint16_t width = x2 - x1 + 1;
+	uint16_t height = y2 - y1 + 1;
+
+	TFT_Gradient_Unpack(color1, &from);
+	TFT_Gradient_Unpack(color2, &to);
+	TFT_Gradient_Step(&from, &to, (direction == TFT_GRADIENT_HORIZONTAL) ? width - 1 : height - 1, &step);
+
+	// 整个矩形只设置一次窗口，颜色逐像素生成到发送缓冲区并连续发送
+	TFT_Set_Address(htft, x1, y1, x2, y2);
+	TFT_Reset_Buffer(htft);
+	TFT_Gradient_Write_Rows(htft, x1, y1, width, height, 0, 0, &from, &step, direction, dither);
+	TFT_Flush_Buffer(htft, 1);
+}
+
+/**
+ * @brief  填充线性渐变圆角矩形
+ * @param  htft TFT句柄指针
+ * @param  x, y 左上角坐标
+ * @param  width, height 宽度和高度
+ * @param  radius 圆角半径
+ * @param  color1 起点颜色 (左侧或顶部)
+ * @param  color2 终点颜色 (右侧或底部)
+ * @param  direction 渐变方向
+ * @param  dither 是否启用 4x4 有序抖动 (1=启用)
+ * @retval 无
+ */
+void TFT_Fill_Gradient_Rounded_Rectangle(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+										 uint8_t radius, uint16_t color1, uint16_t color2,
+										 TFT_Gradient_Direction direction, uint8_t dither)
+{
+	TFT_Gradient_Color from, to, step;
+
+	if (width == 0 || height == 0)
+		return;
+	// 限制圆角半径不超过宽度和高度的一半
+	if (radius > width / 2)
+		radius = width / 2;
+	if (radius > height / 2)
+		radius = height / 2;
+
+	TFT_Gradient_Unpack(color1, &from);
+	TFT_Gradient_Unpack(color2, &to);
+	TFT_Gradient_Step(&from, &to, (direction == TFT_GRADIENT_HORIZONTAL) ? width - 1 : height - 1, &step);
+
+	uint32_t radiusSq = (uint32_t)radius * radius + radius;
+
+	for (uint16_t row = 0; row < radius; row++)
+	{
+		// 圆角行: 按到圆角圆心的距离收缩，上下对称的两行各设置一次窗口
+		int32_t dy = radius - row;
+		uint16_t inset = (uint16_t)(radius - TFT_Isqrt(radiusSq - (uint32_t)(dy * dy)));
+		uint16_t rowWidth = width - 2 * inset;
+		uint16_t rows[2] = {row, (uint16_t)(height - 1 - row)};
+
+		for (uint8_t i = 0; i < 2; i++)
+		{
+			TFT_Set_Address(htft, x + inset, y + rows[i], x + inset + rowWidth - 1, y + rows[i]);
+			TFT_Reset_Buffer(htft);
+			TFT_Gradient_Write_Rows(htft, x + inset, y + rows[i], rowWidth, 1, rows[i], inset, &from, &step, direction, dither);
+		}
+	}
+
+	// 中间满宽的部分只需一个窗口
+	if (height > 2 * radius)
+	{
+		TFT_Set_Address(htft, x, y + radius, x + width - 1, y + height - radius - 1);
+		TFT_Reset_Buffer(htft);
+		TFT_Gradient_Write_Rows(htft, x, y + radius, width, height - 2 * radius, radius, 0, &from, &step, direction, dither);
+	}
+	TFT_Flush_Buffer(htft, 1);
+}
+
+/**
+ * @brief  填充径向渐变圆
+ * @param  htft TFT句柄指针
+ * @param  x0, y0 圆心坐标
+ * @param  r 半径
+ * @param  centerColor 圆心颜色
+ * @param  edgeColor 边缘颜色
+ * @param  dither 是否启用 4x4 有序抖动 (1=启用)
+ * @retval 无
+ * @note   每行设置一次窗口。像素到圆心的距离 (1/16 像素精度) 随列增量跟踪，
+ *         每像素只需比较和加法，无需逐点开方。
+ */
+void TFT_Fill_Radial_Gradient_Circle(TFT_HandleTypeDef *htft, uint16_t x0, uint16_t y0, uint16_t r,
+									 uint16_t centerColor, uint16_t edgeColor, uint8_t dither)
+{
+	TFT_Gradient_Color from, to, slope;
+
+	if (r == 0 || r > 2047)
+		return;
+
+	TFT_Gradient_Unpack(centerColor, &from);
+	TFT_Gradient_Unpack(edgeColor, &to);
+
+	// 每 1/16 像素距离的分量增量 (Q16)
+	int32_t maxDistance = (int32_t)r << 4;
+	slope.r = ((to.r - from.r) << 8) / maxDistance;
+	slope.g = ((to.g - from.g) << 8) / maxDistance;
+	slope.b = ((to.b - from.b) << 8) / maxDistance;
+
+	uint32_t radiusSq = (uint32_t)r * r + r;
+
+	for (int32_t dy = -(int32_t)r; dy <= (int32_t)r; dy++)
+	{
+		int32_t py = (int32_t)y0 + dy;
+		if (py < 0)
+			continue;
+
+		int32_t half = (int32_t)TFT_Isqrt(radiusSq - (uint32_t)(dy * dy));
+		int32_t dx = -half;
+		if ((int32_t)x0 + dx < 0)
+			dx = -(int32_t)x0; // 裁剪到屏幕左边界
+
+		uint16_t px = (uint16_t)((int32_t)x0 + dx);
+		uint16_t count = (uint16_t)(half - dx + 1);
+		const uint8_t *bayerRow = TFT_Bayer_4x4[py & 3];
+
+		// distSq = 256 * (dx^2 + dy^2)，distance = floor(sqrt(distSq)) 即 1/16 像素单位的距离
+		uint32_t distSq = ((uint32_t)(dx * dx) + (uint32_t)(dy * dy)) << 8;
+		int32_t distance = (int32_t)TFT_Isqrt(distSq);
+
+		TFT_Set_Address(htft, px, (uint16_t)py, (uint16_t)(px + count - 1), (uint16_t)py);
+		TFT_Reset_Buffer(htft);
+
+		while (count > 0)
+		{
+			uint16_t length;
+			uint8_t *dst = TFT_Buffer_Reserve(htft, &length);
+			if (dst == NULL)
+				return;
+
+			uint16_t pixels = length >> 1;
+			if (pixels > count)
+				pixels = count;
+
+			for (uint16_t i = 0; i < pixels; i++)
+			{
+				int32_t d = (distance > maxDistance) ? maxDistance : distance;
+				int32_t threshold = dither ? (bayerRow[px & 3] << 4) + 8 : 128;
+				uint16_t color = TFT_Gradient_Pack(from.r + ((slope.r * d) >> 8),
+												   from.g + ((slope.g * d) >> 8),
+												   from.b + ((slope.b * d) >> 8), threshold);
+				*dst++ = color >> 8;
+				*dst++ = color & 0xFF;
+
+				// 下一列: (dx+1)^2 = dx^2 + 2dx + 1，距离单调变化，每步只需少量调整
+				distSq += (uint32_t)(2 * dx + 1) << 8;
+				dx++;
+				px++;
+				while ((uint32_t)((distance + 1) * (distance + 1)) <= distSq)
+					distance++;
+				while ((uint32_t)(distance * distance) > distSq)
+					distance--;
+			}
+
+			TFT_Buffer_Commit(htft, pixels << 1);
+			count -= pixels;
+		}
+	}
+	TFT_Flush_Buffer(htft, 1);
+}
+
+/**
+ * @brief  整数正弦 (四分之一周期查表)
+ * @param  angle 角度 (度)，可以为负数或大于 360，内部自动归一化
+ * @retval sin(angle) 的 Q15 定点值，范围 -32767 ~ 32767
+ */
+int16_t TFT_Sin(int16_t angle)
+{
+	int16_t a = angle % 360;
+	if (a < 0)
+		a += 360;
+
+	if (a <= 90)
+		return TFT_Sine_Table[a];
+	if (a <= 180)
+		return TFT_Sine_Table[180 - a];
+	if (a <= 270)
+		return -TFT_Sine_Table[a - 180];
+	return -TFT_Sine_Table[360 - a];
+}
+
+/**
+ * @brief  整数余弦 (四分之一周期查表)
+ * @param  angle 角度 (度)，可以为负数或大于 360，内部自动归一化
+ * @retval cos(angle) 的 Q15 定点值，范围 -32767 ~ 32767
+ */
+int16_t TFT_Cos(int16_t angle)
+{
+	// cos(a) = sin(a + 90)，先取模避免 int16_t 溢出
+	return TFT_Sin((int16_t)(angle % 360) + 90);
 }
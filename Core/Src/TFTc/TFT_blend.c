@@ -0,0 +1,317 @@
+/*
+ * @file    TFT_blend.c
+ * @brief   RAM 行带缓冲区中的半透明混合
+ */
+#include "TFTh/TFT_blend.h"
+#include <stddef.h> // 用于 NULL
+
+//----------------- 内部辅助函数 -----------------
+
+#define _TFT_BLEND_MASK 0x07E0F81Fu // 展开后的 G (高半字)、R、B (低半字) 通道
+
+/**
+ * @brief 把 RGB565 展开为三个通道互不重叠的 32 位值
+ * @note  G 移到高半字 (位 21~26)，R (位 11~15) 和 B (位 0~4) 留在低半字，各通道上方至少留有 5 位空位，
+ *        乘以 0 ~ 32 的不透明度后三个通道不会相互进位。
+ */
+static inline uint32_t _TFT_Blend_Spread(uint16_t color)
+{
+    return ((uint32_t)color | ((uint32_t)color << 16)) & _TFT_BLEND_MASK;
+}
+
+/**
+ * @brief 混合一个像素
+ * @param fg_alpha 已展开并乘以不透明度的前景色
+ * @param bg       背景色
+ * @param inverse  背景的权重 (32 - 不透明度)
+ * @retval 混合后的颜色: (fg * a + bg * (32 - a)) >> 5，三个通道同时计算
+ */
+static inline uint16_t _TFT_Blend_Pixel(uint32_t fg_alpha, uint16_t bg, uint32_t inverse)
+{
+    uint32_t mix = ((fg_alpha + _TFT_Blend_Spread(bg) * inverse) >> 5) & _TFT_BLEND_MASK;
+
+    return (uint16_t)(mix | (mix >> 16));
+}
+
+/**
+ * @brief 0 ~ 255 的不透明度转换为 0 ~ 32 级
+ */
+static inline uint32_t _TFT_Blend_Level(uint8_t alpha)
+{
+    return ((uint32_t)alpha + 4) >> 3;
+}
+
+/**
+ * @brief 计算矩形落在行带内的部分
+ * @param band   行带
+ * @param x      矩形左上角列坐标 (屏幕坐标)
+ * @param y      矩形左上角行坐标
+ * @param width  矩形宽度
+ * @param height 矩形高度
+ * @param area   输出: 可见部分在矩形内的 {起始列, 起始行, 结束列, 结束行} (结束不包含)
+ * @retval 1: 有可见部分, 0: 完全在行带外
+ */
+static uint8_t _TFT_Band_Clip(const TFT_Band *band, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                              uint16_t area[4])
+{
+    int32_t x0 = x > band->x ? x : band->x;
+    int32_t y0 = y > band->y ? y : band->y;
+    int32_t x1 = (int32_t)x + width < (int32_t)band->x + band->width ? (int32_t)x + width : (int32_t)band->x + band->width;
+    int32_t y1 = (int32_t)y + height < (int32_t)band->y + band->height ? (int32_t)y + height : (int32_t)band->y + band->height;
+
+    if (x0 >= x1 || y0 >= y1)
+        return 0;
+
+    area[0] = x0 - x;
+    area[1] = y0 - y;
+    area[2] = x1 - x;
+    area[3] = y1 - y;
+    return 1;
+}
+
+/**
+ * @brief 行带中对应屏幕坐标 (x, y) 的像素
+ */
+static inline uint16_t *_TFT_Band_At(const TFT_Band *band, int32_t x, int32_t y)
+{
+    return band->pixels + (uint32_t)(y - band->y) * band->width + (x - band->x);
+}
+
+//----------------- 混合函数 -----------------
+
+/**
+ * @brief  混合两个 RGB565 颜色
+ * @param  fg    前景色
+ * @param  bg    背景色
+ * @param  alpha 前景不透明度 (0 ~ 255)
+ * @retval 混合后的颜色
+ */
+uint16_t TFT_Blend_RGB565(uint16_t fg, uint16_t bg, uint8_t alpha)
+{
+    uint32_t level = _TFT_Blend_Level(alpha);
+
+    return _TFT_Blend_Pixel(_TFT_Blend_Spread(fg) * level, bg, 32 - level);
+}
+
+/**
+ * @brief  初始化行带
+ * @param  band   行带
+ * @param  pixels 像素缓冲区
+ * @param  x      行带左上角在屏幕上的列坐标
+ * @param  y      行带左上角在屏幕上的行坐标
+ * @param  width  宽度
+ * @param  height 高度
+ * @retval 无
+ */
+void TFT_Band_Init(TFT_Band *band, uint16_t *pixels, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+    if (band == NULL)
+        return;
+
+    band->pixels = pixels;
+    band->x = x;
+    band->y = y;
+    band->width = width;
+    band->height = height;
+}
+
+/**
+ * @brief  用不透明颜色填充整个行带
+ * @param  band  行带
+ * @param  color 颜色
+ * @retval 无
+ */
+void TFT_Band_Fill(TFT_Band *band, uint16_t color)
+{
+    if (band == NULL || band->pixels == NULL)
+        return;
+
+    uint16_t *dst = band->pixels;
+    for (uint32_t n = (uint32_t)band->width * band->height; n > 0; n--)
+        *dst++ = color;
+}
+
+/**
+ * @brief  半透明填充矩形
+ * @param  band   行带
+ * @param  x      矩形左上角列坐标
+ * @param  y      矩形左上角行坐标
+ * @param  width  宽度
+ * @param  height 高度
+ * @param  color  颜色
+ * @param  alpha  不透明度 (0 ~ 255)
+ * @retval 无
+ */
+void TFT_Band_Blend_Fill(TFT_Band *band, int16_t x, int16_t y, uint16_t width, uint16_t height, uint16_t color, uint8_t alpha)
+{
+    uint32_t level = _TFT_Blend_Level(alpha);
+    uint32_t fg_alpha = _TFT_Blend_Spread(color) * level;
+    uint16_t area[4];
+
+    if (band == NULL || band->pixels == NULL || level == 0 || !_TFT_Band_Clip(band, x, y, width, height, area))
+        return;
+
+    for (uint16_t row = area[1]; row < area[3]; row++)
+    {
+        uint16_t *dst = _TFT_Band_At(band, x + area[0], y + row);
+
+        if (level == 32)
+        {
+            for (uint16_t col = area[0]; col < area[2]; col++)
+                *dst++ = color;
+        }
+        else
+        {
+            for (uint16_t col = area[0]; col < area[2]; col++, dst++)
+                *dst = _TFT_Blend_Pixel(fg_alpha, *dst, 32 - level);
+        }
+    }
+}
+
+/**
+ * @brief  以固定不透明度叠加 RGB565 位图
+ * @param  band   行带
+ * @param  x      位图左上角列坐标
+ * @param  y      位图左上角行坐标
+ * @param  width  位图宽度
+ * @param  height 位图高度
+ * @param  data   RGB565 位图 (高字节在前)
+ * @param  alpha  不透明度 (0 ~ 255)
+ * @retval 无
+ */
+void TFT_Band_Blend_Bitmap(TFT_Band *band, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t *data, uint8_t alpha)
+{
+    uint32_t level = _TFT_Blend_Level(alpha);
+    uint16_t area[4];
+
+    if (band == NULL || band->pixels == NULL || data == NULL || level == 0 || !_TFT_Band_Clip(band, x, y, width, height, area))
+        return;
+
+    for (uint16_t row = area[1]; row < area[3]; row++)
+    {
+        const uint8_t *src = data + ((uint32_t)row * width + area[0]) * 2;
+        uint16_t *dst = _TFT_Band_At(band, x + area[0], y + row);
+
+        for (uint16_t col = area[0]; col < area[2]; col++, src += 2, dst++)
+        {
+            uint16_t pixel = (uint16_t)(src[0] << 8) | src[1];
+
+            *dst = level == 32 ? pixel : _TFT_Blend_Pixel(_TFT_Blend_Spread(pixel) * level, *dst, 32 - level);
+        }
+    }
+}
+
+/**
+ * @brief  按每像素 4 位不透明度叠加 RGB565 位图
+ * @param  band   行带
+ * @param  x      位图左上角列坐标
+ * @param  y      位图左上角行坐标
+ * @param  width  位图宽度
+ * @param  height 位图高度
+ * @param  data   RGB565 位图 (高字节在前)
+ * @param  alpha  每像素 4 位不透明度 (左侧像素在高 4 位)
+ * @retval 无
+ */
+void TFT_Band_Blend_Bitmap_A4(TFT_Band *band, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                              const uint8_t *data, const uint8_t *alpha)
+{
+    uint16_t alpha_bytes = (width + 1) / 2;
+    uint16_t area[4];
+
+    if (band == NULL || band->pixels == NULL || data == NULL || alpha == NULL || !_TFT_Band_Clip(band, x, y, width, height, area))
+        return;
+
+    for (uint16_t row = area[1]; row < area[3]; row++)
+    {
+        const uint8_t *src = data + ((uint32_t)row * width + area[0]) * 2;
+        const uint8_t *mask = alpha + (uint32_t)row * alpha_bytes;
+        uint16_t *dst = _TFT_Band_At(band, x + area[0], y + row);
+
+        for (uint16_t col = area[0]; col < area[2]; col++, src += 2, dst++)
+        {
+            uint8_t a4 = col & 1 ? mask[col >> 1] & 0x0F : mask[col >> 1] >> 4;
+            uint16_t pixel;
+            uint32_t level;
+
+            if (a4 == 0)
+                continue;
+            pixel = (uint16_t)(src[0] << 8) | src[1];
+            if (a4 == 15)
+            {
+                *dst = pixel;
+                continue;
+            }
+            level = a4 * 2 + ((a4 + 4) >> 3); // 0 ~ 15 映射到 0 ~ 32 (四舍五入)
+            *dst = _TFT_Blend_Pixel(_TFT_Blend_Spread(pixel) * level, *dst, 32 - level);
+        }
+    }
+}
+
+/**
+ * @brief  半透明叠加抗锯齿文字
+ * @param  band  行带
+ * @param  x     起始列坐标
+ * @param  y     起始行坐标
+ * @param  str   ASCII 字符串
+ * @param  font  抗锯齿字体
+ * @param  color 文字颜色
+ * @param  alpha 整体不透明度 (0 ~ 255)
+ * @retval 无
+ * @note   先按整体不透明度把各灰度级换算为 0 ~ 32 级并预先乘好前景色，每个边缘像素只需一次乘加。
+ */
+void TFT_Band_Blend_AA_String(TFT_Band *band, int16_t x, int16_t y, const uint8_t *str, const AAFont *font,
+                              uint16_t color, uint8_t alpha)
+{
+    uint32_t fg = _TFT_Blend_Spread(color);
+    uint32_t fg_alpha[16]; // 各灰度级预先乘好的前景色
+    uint8_t levels[16];    // 各灰度级对应的 0 ~ 32 级不透明度
+    uint8_t max_level;
+    uint16_t row_bytes, glyph_bytes;
+    int32_t pen = x;
+
+    if (band == NULL || band->pixels == NULL || str == NULL || font == NULL || (font->bpp != 2 && font->bpp != 4))
+        return;
+
+    max_level = (1 << font->bpp) - 1;
+    row_bytes = ((uint16_t)font->w * font->bpp + 7) / 8;
+    glyph_bytes = (uint16_t)font->h * row_bytes;
+    for (uint8_t i = 0; i <= max_level; i++)
+    {
+        levels[i] = (uint8_t)((i * _TFT_Blend_Level(alpha) * 2 + max_level) / (max_level * 2)); // 四舍五入
+        fg_alpha[i] = fg * levels[i];
+    }
+
+    for (; *str; str++, pen += font->w)
+    {
+        uint8_t chr = *str;
+        const uint8_t *glyph;
+        uint16_t area[4];
+
+        if (pen >= (int32_t)band->x + band->width)
+            break;
+        if (!_TFT_Band_Clip(band, pen, y, font->w, font->h, area))
+            continue;
+        if (chr < font->first || chr > font->last)
+            chr = font->first;
+        glyph = font->data + (chr - font->first) * glyph_bytes;
+
+        for (uint16_t row = area[1]; row < area[3]; row++)
+        {
+            const uint8_t *src = glyph + row * row_bytes;
+            uint16_t *dst = _TFT_Band_At(band, pen + area[0], y + row);
+
+            for (uint16_t col = area[0]; col < area[2]; col++, dst++)
+            {
+                uint16_t bit = col * font->bpp; // 像素在本行中的位偏移，一个字节内先出现的像素在高位
+                uint8_t gray = (src[bit >> 3] >> (8 - font->bpp - (bit & 7))) & max_level;
+
+                if (levels[gray] == 0)
+                    continue;
+                if (levels[gray] == 32)
+                    *dst = color;
+                else
+                    *dst = _TFT_Blend_Pixel(fg_alpha[gray], *dst, 32 - levels[gray]);
+            }
+        }
+    }
+}
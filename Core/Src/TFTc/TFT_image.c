@@ -0,0 +1,735 @@
+/*
+ * @file    TFT_image.c
+ * @brief   TFT屏幕图片显示函数
+ */
+#include "TFTh/TFT_image.h"
+#include "TFTh/TFT_io.h" // 包含绘图函数和 IO 函数
+#include "TFTh/TFT_CAD.h"
+#include <string.h> // 用于 memset/memcpy
+#include <stdlib.h> // 用于 malloc/free
+
+//----------------- 内部辅助函数 -----------------
+
+/**
+ * @brief 计算图片与剪裁矩形的交集
+ * @param htft   TFT句柄指针
+ * @param x      图片左上角列坐标
+ * @param y      图片左上角行坐标
+ * @param width  图片宽度
+ * @param height 图片高度
+ * @param area   输出交集在图片内的范围: 起始列, 起始行, 结束列, 结束行 (结束不包含)
+ * @retval 1: 有可见部分, 0: 完全在剪裁矩形之外
+ */
+static uint8_t _TFT_Image_Clip(TFT_HandleTypeDef *htft, int16_t x, int16_t y, uint16_t width, uint16_t height,
+                               uint16_t area[4])
+{
+    int32_t x0 = x > (int32_t)htft->clip_x0 ? x : (int32_t)htft->clip_x0;
+    int32_t y0 = y > (int32_t)htft->clip_y0 ? y : (int32_t)htft->clip_y0;
+    int32_t x1 = (int32_t)x + width < (int32_t)htft->clip_x1 ? (int32_t)x + width : (int32_t)htft->clip_x1;
+    int32_t y1 = (int32_t)y + height < (int32_t)htft->clip_y1 ? (int32_t)y + height : (int32_t)htft->clip_y1;
+
+    if (x0 >= x1 || y0 >= y1)
+        return 0;
+
+    area[0] = x0 - x;
+    area[1] = y0 - y;
+    area[2] = x1 - x;
+    area[3] = y1 - y;
+    return 1;
+}
+
+/**
+ * @brief 直接以源数据为 DMA 源地址发送到当前窗口
+ * @param htft   TFT句柄指针
+ * @param src    像素数据
+ * @param length 字节数 (可超过一次 DMA 传输的上限)
+ */
+static void _TFT_Image_Send(TFT_HandleTypeDef *htft, const uint8_t *src, uint32_t length)
+{
+    while (length > 0)
+    {
+        uint16_t chunk = length > 65534 ? 65534 : (uint16_t)length; // DMA 计数寄存器为 16 位，保持像素对齐
+
+        // DMA 只读取源数据，去掉 const 以匹配 HAL 的发送接口
+        TFT_SPI_Send(htft, (uint8_t *)src, chunk, 0);
+        src += chunk;
+        length -= chunk;
+    }
+}
+
+/**
+ * @brief 最近邻缩放的定点步进器 (DDA)，把目标坐标逐个映射到源坐标
+ */
+typedef struct
+{
+    uint32_t pos;   // 当前源坐标 (16.16 定点，采样目标像素中心对应的位置)
+    uint32_t step;  // 每个目标像素前进的源像素数 (16.16 定点)
+    uint16_t last;  // 源长度 - 1
+    uint8_t mirror; // 1: 源坐标反向 (从 last 递减)
+} _TFT_Image_Stepper;
+
+/**
+ * @brief 初始化步进器
+ * @param st      步进器
+ * @param src_len 源长度
+ * @param dst_len 目标长度
+ * @param start   第一个目标坐标 (剪裁后可见部分的起点)
+ * @param mirror  源坐标是否反向
+ */
+static void _TFT_Stepper_Init(_TFT_Image_Stepper *st, uint16_t src_len, uint16_t dst_len, uint16_t start, uint8_t mirror)
+{
+    st->step = ((uint32_t)src_len << 16) / dst_len;
+    st->pos = st->step / 2 + st->step * start;
+    st->last = src_len - 1;
+    st->mirror = mirror;
+}
+
+/**
+ * @brief 当前目标坐标对应的源坐标
+ */
+static inline uint16_t _TFT_Stepper_Index(const _TFT_Image_Stepper *st)
+{
+    uint16_t index = st->pos >> 16;
+    return st->mirror ? st->last - index : index;
+}
+
+/**
+ * @brief 按旋转和缩放把源图片流式写入窗口 (不透明)
+ * @param htft     TFT句柄指针
+ * @param x        目标左上角列坐标
+ * @param y        目标左上角行坐标
+ * @param src_w    源宽度
+ * @param src_h    源高度
+ * @param dst_w    目标宽度 (旋转后)
+ * @param dst_h    目标高度 (旋转后)
+ * @param rotation 顺时针旋转 (0: 0°, 1: 90°, 2: 180°, 3: 270°)
+ * @param data     源数据: colors 为 NULL 时是逐行的 RGB565 (高字节在前)，否则是列行式单色图片
+ * @param colors   单色图片的 {前景色, 背景色}，RGB565 图片为 NULL
+ * @note  总是沿源图片的一行连续读取: 旋转 0°/180° 用普通窗口 (目标的一行对应源的一行)，
+ *        90°/270° 用 MV 翻转的按列窗口 (目标的一列对应源的一行)，旋转由屏幕的地址顺序完成。
+ *        需要镜像的方向 (MX/MY 翻转后窗口位置与 GRAM 尺寸有关，不同型号不同) 由步进器反向读取源数据实现。
+ */
+static void _TFT_Image_Stream_Transform(TFT_HandleTypeDef *htft, int16_t x, int16_t y, uint16_t src_w, uint16_t src_h,
+                                        uint16_t dst_w, uint16_t dst_h, uint8_t rotation,
+                                        const uint8_t *data, const uint16_t *colors)
+{
+    _TFT_Image_Stepper outer, inner; // outer: 目标行 (或列) -> 源行，inner: 行内 (或列内) -> 源列
+    uint16_t area[4];                // 可见部分: 起始列, 起始行, 结束列, 结束行
+    uint16_t lines, length;
+
+    if (!_TFT_Image_Clip(htft, x, y, dst_w, dst_h, area))
+        return;
+
+    if (rotation & 1)
+    {
+        TFT_Set_Address_Transposed(htft, x + area[0], y + area[1], x + area[2] - 1, y + area[3] - 1);
+        _TFT_Stepper_Init(&outer, src_h, dst_w, area[0], rotation == 1);
+        _TFT_Stepper_Init(&inner, src_w, dst_h, area[1], rotation == 3);
+        lines = area[2] - area[0];
+        length = area[3] - area[1];
+    }
+    else
+    {
+        TFT_Set_Address(htft, x + area[0], y + area[1], x + area[2] - 1, y + area[3] - 1);
+        _TFT_Stepper_Init(&outer, src_h, dst_h, area[1], rotation == 2);
+        _TFT_Stepper_Init(&inner, src_w, dst_w, area[0], rotation == 2);
+        lines = area[3] - area[1];
+        length = area[2] - area[0];
+    }
+    TFT_Reset_Buffer(htft);
+
+    for (uint16_t line = 0; line < lines; line++, outer.pos += outer.step)
+    {
+        uint16_t row = _TFT_Stepper_Index(&outer);
+        const uint8_t *src = colors ? data + (row >> 3) * src_w : data + (uint32_t)row * src_w * 2;
+        uint8_t mask = 1 << (row & 7);
+        _TFT_Image_Stepper col = inner;
+        uint16_t remain = length;
+
+        while (remain > 0)
+        {
+            uint16_t avail;
+            uint8_t *dst = TFT_Buffer_Reserve(htft, &avail);
+            uint16_t count = avail / 2;
+
+            if (dst == NULL)
+                return;
+            if (count > remain)
+                count = remain;
+            remain -= count;
+
+            for (uint16_t i = 0; i < count; i++, col.pos += col.step)
+            {
+                uint16_t index = _TFT_Stepper_Index(&col);
+
+                if (colors)
+                {
+                    uint16_t color = (src[index] & mask) ? colors[0] : colors[1];
+                    *dst++ = color >> 8;
+                    *dst++ = color & 0xFF;
+                }
+                else
+                {
+                    *dst++ = src[index * 2];
+                    *dst++ = src[index * 2 + 1];
+                }
+            }
+            TFT_Buffer_Commit(htft, count * 2);
+        }
+    }
+
+    TFT_Flush_Buffer(htft, 0); // 最后一块数据不等待发送完成
+}
+
+/**
+ * @brief 压缩图片的解码状态
+ */
+typedef struct
+{
+    const uint8_t *src; // 下一个编码字节
+    const uint8_t *end; // 压缩数据结束位置
+    uint16_t prev;      // 上一个像素
+    uint8_t run;        // 剩余的重复次数
+    uint16_t index[64]; // 最近颜色表
+} _TFT_Packed_Decoder;
+
+/**
+ * @brief 解码下一个像素
+ * @param dec 解码状态
+ * @retval RGB565 像素 (数据不完整时重复最后一个像素)
+ */
+static inline uint16_t _TFT_Packed_Next(_TFT_Packed_Decoder *dec)
+{
+    uint16_t pixel = dec->prev;
+    uint8_t op;
+
+    if (dec->run)
+    {
+        dec->run--;
+        return pixel;
+    }
+    if (dec->src >= dec->end)
+        return pixel;
+
+    op = *dec->src++;
+    if (op == 0xFE)
+    {
+        // RGB: 原值
+        pixel = (uint16_t)(dec->src[0] << 8) | dec->src[1];
+        dec->src += 2;
+    }
+    else if ((op & 0xC0) == 0xC0)
+    {
+        // RUN: 本像素加上之后 n 个像素都等于上一像素
+        dec->run = op & 0x3F;
+        return pixel;
+    }
+    else if ((op & 0xC0) == 0x00)
+    {
+        // INDEX
+        pixel = dec->index[op];
+    }
+    else
+    {
+        int8_t dr, dg, db;
+
+        if ((op & 0xC0) == 0x40)
+        {
+            // DIFF: 各通道 -2~1
+            dr = ((op >> 4) & 0x03) - 2;
+            dg = ((op >> 2) & 0x03) - 2;
+            db = (op & 0x03) - 2;
+        }
+        else
+        {
+            // LUMA: G 差值 -32~31，R/B 相对 G 差值 -8~7
+            uint8_t next = *dec->src++;
+
+            dg = (op & 0x3F) - 32;
+            dr = dg + (next >> 4) - 8;
+            db = dg + (next & 0x0F) - 8;
+        }
+        pixel = (uint16_t)((((pixel >> 11) + dr) & 0x1F) << 11) |
+                (uint16_t)(((((pixel >> 5) & 0x3F) + dg) & 0x3F) << 5) |
+                (uint16_t)(((pixel & 0x1F) + db) & 0x1F);
+    }
+
+    dec->index[((pixel >> 11) * 3 + ((pixel >> 5) & 0x3F) * 5 + (pixel & 0x1F) * 7) & 0x3F] = pixel;
+    dec->prev = pixel;
+    return pixel;
+}
+
+/**
+ * @brief 解码并丢弃若干像素 (剪裁掉的部分)
+ * @param dec   解码状态
+ * @param count 像素数
+ */
+static void _TFT_Packed_Skip(_TFT_Packed_Decoder *dec, uint32_t count)
+{
+    while (count > 0)
+    {
+        if (dec->run)
+        {
+            // 游程整段跳过
+            uint8_t n = dec->run < count ? dec->run : (uint8_t)count;
+            dec->run -= n;
+            count -= n;
+            continue;
+        }
+        _TFT_Packed_Next(dec);
+        count--;
+    }
+}
+
+/**
+ * @brief JPEG 解码输出的目标位置
+ */
+typedef struct
+{
+    TFT_HandleTypeDef *htft;
+    int16_t x; // 图片左上角列坐标
+    int16_t y; // 图片左上角行坐标
+} _TFT_JPEG_Target;
+
+/**
+ * @brief JPEG 解码器的输出函数: 把一个 MCU 的像素写入它自己的地址窗口
+ * @note  只等待上一个块的 DMA 完成后再设置窗口，本块的发送与下一个 MCU 的解码并行。
+ */
+static void _TFT_JPEG_Write_Block(void *context, uint16_t bx, uint16_t by, uint16_t width, uint16_t height,
+                                  const uint8_t *pixels)
+{
+    _TFT_JPEG_Target *target = (_TFT_JPEG_Target *)context;
+    TFT_HandleTypeDef *htft = target->htft;
+    int16_t x = target->x + bx;
+    int16_t y = target->y + by;
+    uint16_t area[4]; // 可见部分: 起始列, 起始行, 结束列, 结束行
+
+    if (!_TFT_Image_Clip(htft, x, y, width, height, area))
+        return;
+
+    TFT_Set_Address(htft, x + area[0], y + area[1], x + area[2] - 1, y + area[3] - 1);
+    TFT_Reset_Buffer(htft);
+    for (uint16_t row = area[1]; row < area[3]; row++)
+    {
+        const uint8_t *src = pixels + ((uint32_t)row * width + area[0]) * 2;
+        uint16_t length = (area[2] - area[0]) * 2;
+
+        while (length > 0)
+        {
+            uint16_t avail;
+            uint8_t *dst = TFT_Buffer_Reserve(htft, &avail);
+
+            if (dst == NULL)
+                return;
+            if (avail > length)
+                avail = length;
+            memcpy(dst, src, avail);
+            TFT_Buffer_Commit(htft, avail);
+            src += avail;
+            length -= avail;
+        }
+    }
+    TFT_Flush_Buffer(htft, 0);
+}
+
+//----------------- 图片显示函数 -----------------
+
+/**
+ * @brief  绘制单色图片
+ * @param  htft TFT句柄指针
+ * @param  x          左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+ * @param  y          左上角行坐标 (可为负数)
+ * @param  image      图片 (列行式: 每 8 行为一页，页内每列 1 字节，LSB 在上)
+ * @param  color      点亮像素的颜色
+ * @param  back_color 背景颜色
+ * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+ * @retval 无
+ * @note   列行式数据的一个字节正好是一列中连续的 8 个像素，不透明时使用按列填充的窗口，
+ *         逐列把同一列各页的字节拼接后查表展开 (每次最多 32 个像素)，整幅图片一次连续的 DMA 数据流。
+ */
+void TFT_Draw_Image_1bpp(TFT_HandleTypeDef *htft, int16_t x, int16_t y, const Image *image, uint16_t color, uint16_t back_color, uint8_t mode)
+{
+    uint16_t area[4]; // 可见部分: 起始列, 起始行, 结束列, 结束行
+
+    if (htft == NULL || image == NULL || image->data == NULL)
+        return;
+    if (!_TFT_Image_Clip(htft, x, y, image->w, image->h, area))
+        return;
+
+    if (mode == 0)
+    {
+        TFT_Set_Address_Transposed(htft, x + area[0], y + area[1], x + area[2] - 1, y + area[3] - 1);
+        TFT_Reset_Buffer(htft);
+
+        for (uint16_t col = area[0]; col < area[2]; col++)
+        {
+            const uint8_t *src = image->data + col;
+            uint32_t bits = 0;
+            uint8_t count = 0;
+
+            for (uint16_t row = area[1]; row < area[3];)
+            {
+                uint8_t shift = row & 7;
+                uint8_t rows = 8 - shift; // 本页剩余的行数
+
+                if (rows > area[3] - row)
+                    rows = area[3] - row;
+                if (count + rows > 32)
+                {
+                    TFT_Buffer_Write_Mono(htft, bits, count, color, back_color);
+                    bits = 0;
+                    count = 0;
+                }
+                bits |= (uint32_t)(src[(row >> 3) * image->w] >> shift) << count;
+                count += rows;
+                row += rows;
+            }
+            TFT_Buffer_Write_Mono(htft, bits, count, color, back_color);
+        }
+
+        TFT_Flush_Buffer(htft, 0); // 最后一块数据不等待发送完成
+        return;
+    }
+
+    // 背景透明: 每行连续的点亮像素为一条线段
+    TFT_Span_Sink sink;
+
+    TFT_Span_Begin(&sink, htft, color);
+    for (uint16_t row = area[1]; row < area[3]; row++)
+    {
+        const uint8_t *src = image->data + (row >> 3) * image->w;
+        uint8_t shift = row & 7;
+        uint16_t col = area[0];
+
+        while (col < area[2])
+        {
+            uint16_t start;
+
+            while (col < area[2] && !((src[col] >> shift) & 0x01))
+                col++;
+            start = col;
+            while (col < area[2] && ((src[col] >> shift) & 0x01))
+                col++;
+            if (col > start)
+                TFT_Span_Add(&sink, x + start, y + row, col - start);
+        }
+    }
+    TFT_Span_End(&sink);
+}
+
+/**
+ * @brief  绘制 RGB565 彩色位图
+ * @param  htft TFT句柄指针
+ * @param  x      左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+ * @param  y      左上角行坐标 (可为负数)
+ * @param  width  位图宽度
+ * @param  height 位图高度
+ * @param  data   像素数据 (逐行存放，每像素 2 字节，高字节在前)
+ * @retval 无
+ * @note   只设置一次地址窗口，之后 DMA 直接从 data 读取数据，CPU 不拷贝像素。
+ */
+void TFT_Draw_Bitmap565(TFT_HandleTypeDef *htft, int16_t x, int16_t y, uint16_t width, uint16_t height, const uint8_t *data)
+{
+    uint16_t area[4]; // 可见部分: 起始列, 起始行, 结束列, 结束行
+    const uint8_t *src;
+    uint32_t row_bytes = (uint32_t)width * 2;
+    uint32_t visible_bytes;
+
+    if (htft == NULL || data == NULL)
+        return;
+    if (!_TFT_Image_Clip(htft, x, y, width, height, area))
+        return;
+
+    src = data + area[1] * row_bytes + area[0] * 2;
+    visible_bytes = (uint32_t)(area[2] - area[0]) * 2;
+
+    TFT_Set_Address(htft, x + area[0], y + area[1], x + area[2] - 1, y + area[3] - 1);
+
+    if (visible_bytes == row_bytes)
+    {
+        // 整行可见: 各行数据连续，整块发送
+        _TFT_Image_Send(htft, src, visible_bytes * (area[3] - area[1]));
+        return;
+    }
+
+    for (uint16_t row = area[1]; row < area[3]; row++, src += row_bytes)
+    {
+        _TFT_Image_Send(htft, src, visible_bytes);
+    }
+}
+
+/**
+ * @brief  缩放和旋转绘制单色图片
+ * @param  htft       TFT句柄指针
+ * @param  x          左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+ * @param  y          左上角行坐标 (可为负数)
+ * @param  image      图片 (列行式，同 TFT_Draw_Image_1bpp)
+ * @param  width      屏幕上的宽度 (旋转后)，与 height 之一为 0 时使用原尺寸
+ * @param  height     屏幕上的高度 (旋转后)
+ * @param  rotation   顺时针旋转 (0: 0°, 1: 90°, 2: 180°, 3: 270°)
+ * @param  color      点亮像素的颜色
+ * @param  back_color 背景颜色
+ * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+ * @retval 无
+ * @note   最近邻缩放，行、列各用一个 16.16 定点步进器把目标坐标映射到源坐标。
+ *         不透明时 90°/270° 使用按列填充的窗口，由屏幕的地址顺序完成旋转，整幅图片一次连续的数据流；
+ *         透明时逐行查找点亮像素的线段。
+ */
+void TFT_Draw_Image_1bpp_Transform(TFT_HandleTypeDef *htft, int16_t x, int16_t y, const Image *image,
+                                   uint16_t width, uint16_t height, uint8_t rotation,
+                                   uint16_t color, uint16_t back_color, uint8_t mode)
+{
+    _TFT_Image_Stepper row_step, col_step;
+    uint16_t area[4]; // 可见部分: 起始列, 起始行, 结束列, 结束行
+    uint8_t swap;     // 1: 目标的行对应源的列 (旋转 90°/270°)
+
+    if (htft == NULL || image == NULL || image->data == NULL || image->w == 0 || image->h == 0)
+        return;
+
+    rotation &= 3;
+    swap = rotation & 1;
+    if (width == 0 || height == 0)
+    {
+        width = swap ? image->h : image->w;
+        height = swap ? image->w : image->h;
+    }
+    if (rotation == 0 && width == image->w && height == image->h)
+    {
+        TFT_Draw_Image_1bpp(htft, x, y, image, color, back_color, mode);
+        return;
+    }
+
+    if (mode == 0)
+    {
+        uint16_t colors[2] = {color, back_color};
+        _TFT_Image_Stream_Transform(htft, x, y, image->w, image->h, width, height, rotation, image->data, colors);
+        return;
+    }
+
+    // 背景透明: 逐行把目标像素映射回源图片，连续的点亮像素为一条线段
+    if (!_TFT_Image_Clip(htft, x, y, width, height, area))
+        return;
+    if (swap)
+    {
+        _TFT_Stepper_Init(&row_step, image->w, height, area[1], rotation == 3);
+        _TFT_Stepper_Init(&col_step, image->h, width, area[0], rotation == 1);
+    }
+    else
+    {
+        _TFT_Stepper_Init(&row_step, image->h, height, area[1], rotation == 2);
+        _TFT_Stepper_Init(&col_step, image->w, width, area[0], rotation == 2);
+    }
+
+    TFT_Span_Sink sink;
+
+    TFT_Span_Begin(&sink, htft, color);
+    for (uint16_t row = area[1]; row < area[3]; row++, row_step.pos += row_step.step)
+    {
+        uint16_t a = _TFT_Stepper_Index(&row_step);
+        _TFT_Image_Stepper col = col_step;
+        uint16_t start = 0;
+        uint8_t in_run = 0;
+
+        for (uint16_t c = area[0]; c <= area[2]; c++, col.pos += col.step)
+        {
+            uint8_t on = 0;
+
+            if (c < area[2])
+            {
+                uint16_t b = _TFT_Stepper_Index(&col);
+                uint16_t sx = swap ? a : b;
+                uint16_t sy = swap ? b : a;
+
+                on = (image->data[(sy >> 3) * image->w + sx] >> (sy & 7)) & 0x01;
+            }
+            if (on && !in_run)
+                start = c;
+            else if (!on && in_run)
+                TFT_Span_Add(&sink, x + start, y + row, c - start);
+            in_run = on;
+        }
+    }
+    TFT_Span_End(&sink);
+}
+
+/**
+ * @brief  缩放和旋转绘制 RGB565 彩色位图
+ * @param  htft       TFT句柄指针
+ * @param  x          左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+ * @param  y          左上角行坐标 (可为负数)
+ * @param  src_width  位图宽度
+ * @param  src_height 位图高度
+ * @param  data       像素数据 (同 TFT_Draw_Bitmap565)
+ * @param  width      屏幕上的宽度 (旋转后)，与 height 之一为 0 时使用原尺寸
+ * @param  height     屏幕上的高度 (旋转后)
+ * @param  rotation   顺时针旋转 (0: 0°, 1: 90°, 2: 180°, 3: 270°)
+ * @retval 无
+ * @note   最近邻缩放，按源图片的行顺序读取，经步进器选出的像素直接写入发送缓冲区，DMA 同时发送另一半区。
+ *         90°/270° 使用按列填充的窗口，由屏幕的地址顺序完成旋转，不逐像素计算坐标变换。
+ *         不缩放也不旋转时等同于 TFT_Draw_Bitmap565 (DMA 直接读取 data)。
+ */
+void TFT_Draw_Bitmap565_Transform(TFT_HandleTypeDef *htft, int16_t x, int16_t y, uint16_t src_width, uint16_t src_height,
+                                  const uint8_t *data, uint16_t width, uint16_t height, uint8_t rotation)
+{
+    if (htft == NULL || data == NULL || src_width == 0 || src_height == 0)
+        return;
+
+    rotation &= 3;
+    if (width == 0 || height == 0)
+    {
+        width = (rotation & 1) ? src_height : src_width;
+        height = (rotation & 1) ? src_width : src_height;
+    }
+    if (rotation == 0 && width == src_width && height == src_height)
+    {
+        TFT_Draw_Bitmap565(htft, x, y, width, height, data);
+        return;
+    }
+
+    _TFT_Image_Stream_Transform(htft, x, y, src_width, src_height, width, height, rotation, data, NULL);
+}
+
+/**
+ * @brief  绘制 QOI 风格压缩的 RGB565 图片
+ * @param  htft  TFT句柄指针
+ * @param  x     左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+ * @param  y     左上角行坐标 (可为负数)
+ * @param  image 压缩图片
+ * @retval 无
+ * @note   像素解码后直接写入 TFT_Buffer_Reserve 返回的当前半区，半区写满时提交并启动 DMA，
+ *         随即在另一半区继续解码，解码与发送并行。被剪裁的像素仍需解码 (后面的像素依赖它们)，但不发送。
+ */
+void TFT_Draw_Packed_Image(TFT_HandleTypeDef *htft, int16_t x, int16_t y, const PackedImage *image)
+{
+    _TFT_Packed_Decoder dec;
+    uint16_t area[4]; // 可见部分: 起始列, 起始行, 结束列, 结束行
+    uint8_t *dst = NULL;
+    uint16_t avail = 0; // 当前申请到的剩余空间 (字节)
+    uint16_t used = 0;  // 当前申请到的空间中已写入的字节数
+
+    if (htft == NULL || image == NULL || image->data == NULL)
+        return;
+    if (!_TFT_Image_Clip(htft, x, y, image->w, image->h, area))
+        return;
+
+    dec.src = image->data;
+    dec.end = image->data + image->size;
+    dec.prev = 0x0000;
+    dec.run = 0;
+    memset(dec.index, 0, sizeof(dec.index));
+
+    TFT_Set_Address(htft, x + area[0], y + area[1], x + area[2] - 1, y + area[3] - 1);
+    TFT_Reset_Buffer(htft);
+
+    _TFT_Packed_Skip(&dec, (uint32_t)area[1] * image->w + area[0]); // 可见区域之前的像素
+    for (uint16_t row = area[1]; row < area[3]; row++)
+    {
+        for (uint16_t col = area[0]; col < area[2]; col++)
+        {
+            uint16_t pixel = _TFT_Packed_Next(&dec);
+
+            if (avail == 0)
+            {
+                if (used != 0)
+                    TFT_Buffer_Commit(htft, used);
+                dst = TFT_Buffer_Reserve(htft, &avail);
+                used = 0;
+                if (dst == NULL)
+                    return;
+            }
+            *dst++ = pixel >> 8;
+            *dst++ = pixel & 0xFF;
+            avail -= 2;
+            used += 2;
+        }
+        if (row + 1 < area[3])
+            _TFT_Packed_Skip(&dec, image->w - (area[2] - area[0])); // 本行右侧和下一行左侧被剪裁的像素
+    }
+
+    TFT_Buffer_Commit(htft, used);
+    TFT_Flush_Buffer(htft, 0); // 最后一块数据不等待发送完成
+}
+
+/**
+ * @brief  解码并绘制基线 JPEG 图片
+ * @param  htft  TFT句柄指针
+ * @param  x     左上角列坐标 (可为负数，超出剪裁矩形的部分不绘制)
+ * @param  y     左上角行坐标 (可为负数)
+ * @param  data  JPEG 文件数据 (可以在 Flash 中)
+ * @param  size  数据字节数
+ * @param  scale 缩小比例 (0: 1/1, 1: 1/2, 2: 1/4, 3: 1/8)
+ * @retval 解码结果
+ * @note   解码器工作内存 (约 3 KB) 在绘制期间 malloc，结束后释放。
+ *         每个 MCU (8x8 或 16x16 像素，缩小后相应变小) 解码后设置一次地址窗口写入，
+ *         DMA 发送当前块时解码下一个块。
+ */
+TFT_JPEG_Result TFT_Draw_JPEG(TFT_HandleTypeDef *htft, int16_t x, int16_t y, const uint8_t *data, uint32_t size, uint8_t scale)
+{
+    TFT_JPEG_Memory source = {data, size, 0};
+    _TFT_JPEG_Target target = {htft, x, y};
+    TFT_JPEG_Decoder *dec;
+    TFT_JPEG_Result result;
+
+    if (htft == NULL || data == NULL)
+        return TFT_JPEG_ERR_INPUT;
+
+    dec = (TFT_JPEG_Decoder *)malloc(sizeof(TFT_JPEG_Decoder));
+    if (dec == NULL)
+        return TFT_JPEG_ERR_MEMORY;
+
+    result = TFT_JPEG_Prepare(dec, TFT_JPEG_Read_Memory, &source);
+    if (result == TFT_JPEG_OK)
+        result = TFT_JPEG_Decompress(dec, scale, _TFT_JPEG_Write_Block, &target);
+
+    free(dec);
+    return result;
+}
+
+/**
+ * @brief  把行带缓冲区发送到屏幕上它所在的位置
+ * @param  htft TFT句柄指针
+ * @param  band 行带
+ * @retval 无
+ * @note   行带像素为 CPU 字节顺序，逐个转换为高字节在前写入发送缓冲区。
+ */
+void TFT_Draw_Band(TFT_HandleTypeDef *htft, const TFT_Band *band)
+{
+    uint16_t area[4];
+
+    if (htft == NULL || band == NULL || band->pixels == NULL)
+        return;
+    if (!_TFT_Image_Clip(htft, band->x, band->y, band->width, band->height, area))
+        return;
+
+    TFT_Set_Address(htft, band->x + area[0], band->y + area[1], band->x + area[2] - 1, band->y + area[3] - 1);
+    TFT_Reset_Buffer(htft);
+
+    for (uint16_t row = area[1]; row < area[3]; row++)
+    {
+        const uint16_t *src = band->pixels + (uint32_t)row * band->width + area[0];
+        uint16_t remaining = area[2] - area[0];
+
+        while (remaining > 0)
+        {
+            uint16_t avail;
+            uint8_t *dst = TFT_Buffer_Reserve(htft, &avail);
+            uint16_t count = avail / 2;
+
+            if (dst == NULL)
+                return;
+            if (count > remaining)
+                count = remaining;
+
+            for (uint16_t i = 0; i < count; i++)
+            {
+                *dst++ = src[i] >> 8;
+                *dst++ = src[i] & 0xFF;
+            }
+            TFT_Buffer_Commit(htft, count * 2);
+            src += count;
+            remaining -= count;
+        }
+    }
+
+    TFT_Flush_Buffer(htft, 0); // 最后一块数据不等待发送完成
+}
@@ -173,21 +173,23 @@ static void TFT_Set_Direction(TFT_HandleTypeDef *htft, uint8_t direction)
 	switch (direction)
 	{
 	case 0:							 // 0度旋转
-		TFT_Write_Data8(htft, 0x00); // MY=0, MX=0, MV=0, RGB
+		htft->madctl = 0x00; // MY=0, MX=0, MV=0, RGB
 		break;
 	case 1:							 // 90度旋转
-		TFT_Write_Data8(htft, 0xA0); // MY=1, MX=0, MV=1, RGB
+		htft->madctl = 0xA0; // MY=1, MX=0, MV=1, RGB
 		break;
 	case 2:							 // 180度旋转
-		TFT_Write_Data8(htft, 0xC0); // MY=1, MX=1, MV=0, RGB
+		htft->madctl = 0xC0; // MY=1, MX=1, MV=0, RGB
 		break;
 	case 3:							 // 270度旋转
-		TFT_Write_Data8(htft, 0x60); // MY=0, MX=1, MV=1, RGB
+		htft->madctl = 0x60; // MY=0, MX=1, MV=1, RGB
 		break;
 	default:						 // 默认0度旋转
-		TFT_Write_Data8(htft, 0xC0); // MY=1, MX=1, MV=0, RGB
+		htft->madctl = 0xC0; // MY=1, MX=1, MV=0, RGB
 		break;
 	}
+	TFT_Write_Data8(htft, htft->madctl);
+	htft->madctl_transposed = 0;
 }
 
 /**
@@ -7,6 +7,7 @@
 #include "TFTh/TFT_io.h"
 #include <stdint.h>
 #include <stdlib.h> // 用于malloc/free
+#include <string.h> // 用于memcpy
 
 /**
 内存限制说明：
@@ -51,6 +52,9 @@ void TFT_Init_Instance(TFT_HandleTypeDef *htft, SPI_HandleTypeDef *hspi,
 	htft->display_direction = DISPLAY_DIRECTION;
 	htft->x_offset = TFT_X_OFFSET;
 	htft->y_offset = TFT_Y_OFFSET;
+	htft->madctl = 0x00; // 复位后的默认值，屏幕初始化时按方向更新
+	htft->madctl_transposed = 0;
+	TFT_Reset_Clip(htft);
 }
 
 /**
@@ -94,6 +98,36 @@ void TFT_Config_Display(TFT_HandleTypeDef *htft,
 	htft->y_offset = y_offset;
 }
 
+/**
+ * @brief  设置剪裁矩形
+ * @param  htft TFT句柄指针
+ * @param  x0 左边界
+ * @param  y0 上边界
+ * @param  x1 右边界 (不包含)
+ * @param  y1 下边界 (不包含)
+ * @retval 无
+ */
+void TFT_Set_Clip(TFT_HandleTypeDef *htft, uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1)
+{
+	if (htft == NULL)
+		return;
+
+	htft->clip_x0 = x0;
+	htft->clip_y0 = y0;
+	htft->clip_x1 = x1;
+	htft->clip_y1 = y1;
+}
+
+/**
+ * @brief  取消剪裁矩形
+ * @param  htft TFT句柄指针
+ * @retval 无
+ */
+void TFT_Reset_Clip(TFT_HandleTypeDef *htft)
+{
+	TFT_Set_Clip(htft, 0, 0, 0xFFFF, 0xFFFF);
+}
+
 /**
  * @brief  注册TFT设备到全局设备列表
  * @param  htft TFT句柄指针
@@ -273,29 +307,126 @@ void TFT_SPI_Send(TFT_HandleTypeDef *htft, uint8_t *data_buffer, uint16_t length
 	}
 }
 
+/**
+ * @brief  获取指定半区的起始地址和容量 (内部辅助函数)
+ * @param  htft TFT句柄指针
+ * @param  half 半区序号 (0/1)
+ * @param  capacity 输出半区容量 (字节，偶数)
+ * @retval 半区起始地址
+ * @note   DMA 模式下发送缓冲区分为两个半区交替使用: 一个半区由 DMA 发送时，
+ *         CPU 继续向另一个半区写入，写入不会覆盖正在发送的数据。
+ *         阻塞模式下发送完成才返回，整个缓冲区作为一个区使用。
+ */
+static uint8_t *TFT_Buffer_Half(TFT_HandleTypeDef *htft, uint8_t half, uint16_t *capacity)
+{
+	if (htft->is_dma_enabled)
+	{
+		uint16_t size = (htft->buffer_size / 2) & ~1u;
+		*capacity = size;
+		return htft->tx_buffer + (half ? size : 0);
+	}
+
+	*capacity = htft->buffer_size & ~1u;
+	return htft->tx_buffer;
+}
+
+/**
+ * @brief  获取当前写入半区的起始地址和容量 (内部辅助函数)
+ * @param  htft TFT句柄指针
+ * @param  capacity 输出当前半区容量 (字节，偶数)
+ * @retval 当前写入半区的起始地址
+ * @note   若当前半区保存着纯色数据 (可能仍在被 DMA 重复发送)，先切换到另一半区再写入。
+ */
+static uint8_t *TFT_Buffer_Current(TFT_HandleTypeDef *htft, uint16_t *capacity)
+{
+	if (htft->prepared_color_valid)
+	{
+		htft->prepared_color_valid = 0;
+		htft->buffer_half ^= 1;
+		htft->buffer_write_index = 0;
+	}
+
+	return TFT_Buffer_Half(htft, htft->buffer_half, capacity);
+}
+
 /**
  * @brief  向发送缓冲区写入 16 位数据 (通常是颜色值)
  * @param  htft TFT句柄指针
  * @param  data 要写入的 16 位数据
  * @retval 无
  * @note   数据以大端模式 (高字节在前) 写入缓冲区。
- *         如果缓冲区空间不足以写入 2 字节，会自动刷新缓冲区 (非阻塞)。
+ *         如果当前半区空间不足以写入 2 字节，会自动刷新 (非阻塞) 并切换到另一半区。
  */
 void TFT_Buffer_Write16(TFT_HandleTypeDef *htft, uint16_t data)
 {
+	uint16_t capacity;
+	uint8_t *buffer;
+
 	// 检查参数
 	if (htft == NULL || htft->tx_buffer == NULL)
 		return;
 
+	buffer = TFT_Buffer_Current(htft, &capacity);
+
 	// 检查缓冲区剩余空间是否足够存放 16 位数据 (2字节)
-	if (htft->buffer_write_index >= htft->buffer_size - 1)
+	if (htft->buffer_write_index + 2 > capacity)
 	{
 		TFT_Flush_Buffer(htft, 0); // 缓冲区满，刷新缓冲区，不等待完成
+		buffer = TFT_Buffer_Current(htft, &capacity);
 	}
 
 	// 将 16 位数据按大端序写入缓冲区
-	htft->tx_buffer[htft->buffer_write_index++] = (data >> 8) & 0xFF; // 高字节
-	htft->tx_buffer[htft->buffer_write_index++] = data & 0xFF;		  // 低字节
+	buffer[htft->buffer_write_index++] = (data >> 8) & 0xFF; // 高字节
+	buffer[htft->buffer_write_index++] = data & 0xFF;		 // 低字节
+}
+
+/**
+ * @brief  申请直接写入发送缓冲区的空间
+ * @param  htft TFT句柄指针
+ * @param  length 输出可连续写入的字节数 (偶数，至少 2)
+ * @retval 可写入位置的指针，失败时返回 NULL
+ * @note   调用者把数据直接生成到返回的地址，再用 TFT_Buffer_Commit 提交实际写入的字节数。
+ *         当前半区已满时会先刷新 (非阻塞)，因此返回的空间总是可用的。
+ */
+uint8_t *TFT_Buffer_Reserve(TFT_HandleTypeDef *htft, uint16_t *length)
+{
+	uint16_t capacity;
+	uint8_t *buffer;
+
+	if (htft == NULL || htft->tx_buffer == NULL || length == NULL)
+		return NULL;
+
+	buffer = TFT_Buffer_Current(htft, &capacity);
+	if (htft->buffer_write_index + 2 > capacity)
+	{
+		TFT_Flush_Buffer(htft, 0);
+		buffer = TFT_Buffer_Current(htft, &capacity);
+	}
+
+	*length = capacity - htft->buffer_write_index;
+	return buffer + htft->buffer_write_index;
+}
+
+/**
+ * @brief  提交通过 TFT_Buffer_Reserve 写入的数据
+ * @param  htft TFT句柄指针
+ * @param  length 实际写入的字节数 (不超过 Reserve 返回的长度)
+ * @retval 无
+ * @note   当前半区写满时自动启动发送 (非阻塞)。
+ */
+void TFT_Buffer_Commit(TFT_HandleTypeDef *htft, uint16_t length)
+{
+	uint16_t capacity;
+
+	if (htft == NULL || htft->tx_buffer == NULL)
+		return;
+
+	TFT_Buffer_Current(htft, &capacity);
+	htft->buffer_write_index += length;
+	if (htft->buffer_write_index + 2 > capacity)
+	{
+		TFT_Flush_Buffer(htft, 0);
+	}
 }
 
 /**
@@ -303,16 +434,170 @@ void TFT_Buffer_Write16(TFT_HandleTypeDef *htft, uint16_t data)
  * @param  htft TFT句柄指针
  * @param  wait_completion 是否等待传输完成 (1=等待, 0=不等待，仅 DMA 模式有效)
  * @retval 无
+ * @note   DMA 模式下发送后切换到另一半区，下一次写入与本次发送并行进行。
  */
 void TFT_Flush_Buffer(TFT_HandleTypeDef *htft, uint8_t wait_completion)
 {
+	uint16_t capacity;
+	uint8_t *buffer;
+
 	if (htft == NULL || htft->tx_buffer == NULL || htft->buffer_write_index == 0)
 		return; // 缓冲区为空，无需刷新
 
+	buffer = TFT_Buffer_Current(htft, &capacity);
+
 	// 调用 TFT_SPI_Send 发送缓冲区中的数据
-	TFT_SPI_Send(htft, htft->tx_buffer, htft->buffer_write_index, wait_completion);
+	TFT_SPI_Send(htft, buffer, htft->buffer_write_index, wait_completion);
 
 	htft->buffer_write_index = 0; // 发送后重置缓冲区索引
+	htft->buffer_half ^= 1;		  // 切换半区 (SPI_Send 保证另一半区的传输已经结束)
+}
+
+/**
+ * @brief  预先把纯色像素填满空闲的半区
+ * @param  htft TFT句柄指针
+ * @param  color 颜色 (RGB565格式)
+ * @retval 无
+ * @note   只写入当前没有被 DMA 读取的半区，因此可以在上一次填充的 DMA 传输进行时调用，
+ *         让下一块纯色数据的准备与传输并行。若该半区已经是此颜色则直接返回。
+ */
+void TFT_Buffer_Prepare_Color(TFT_HandleTypeDef *htft, uint16_t color)
+{
+	uint16_t capacity;
+	uint8_t *buffer;
+
+	if (htft == NULL || htft->tx_buffer == NULL)
+		return;
+
+	if (htft->prepared_color_valid && htft->prepared_color == color)
+		return; // 已准备好
+
+	if (htft->buffer_write_index != 0)
+		TFT_Flush_Buffer(htft, 0); // 先发出尚未发送的数据 (会切换到空闲半区)
+
+	buffer = TFT_Buffer_Current(htft, &capacity); // 若当前半区是其他纯色，切换到空闲半区
+
+	uint8_t high = color >> 8;
+	uint8_t low = color & 0xFF;
+	for (uint16_t i = 0; i < capacity; i += 2)
+	{
+		buffer[i] = high;
+		buffer[i + 1] = low;
+	}
+
+	htft->prepared_color = color;
+	htft->prepared_color_valid = 1;
+}
+
+/**
+ * @brief  向当前窗口连续发送纯色像素
+ * @param  htft TFT句柄指针
+ * @param  color 颜色 (RGB565格式)
+ * @param  count 像素数量
+ * @retval 无
+ * @note   半区只填充一次，之后重复把同一半区交给 DMA 发送，CPU 不再逐像素写缓冲区。
+ *         函数不等待最后一次传输完成，后续的命令、窗口设置或数据写入会自动等待。
+ */
+void TFT_Write_Color_Repeat(TFT_HandleTypeDef *htft, uint16_t color, uint32_t count)
+{
+	uint16_t capacity;
+
+	if (htft == NULL || htft->tx_buffer == NULL || count == 0)
+		return;
+
+	TFT_Buffer_Prepare_Color(htft, color);
+	if (!htft->prepared_color_valid)
+		return;
+
+	uint8_t *buffer = TFT_Buffer_Half(htft, htft->buffer_half, &capacity);
+	uint32_t remaining = count * 2;
+
+	while (remaining > 0)
+	{
+		uint16_t chunk = (remaining > capacity) ? capacity : (uint16_t)remaining;
+		TFT_SPI_Send(htft, buffer, chunk, 0); // 内部会等待上一块传输完成
+		remaining -= chunk;
+	}
+}
+
+static uint8_t g_mono_lut[16][8];  // 4 位像素 -> 4 个大端 RGB565 像素 (bit0 对应第一个像素)
+static uint16_t g_mono_lut_color;  // 当前展开表的前景色
+static uint16_t g_mono_lut_back;   // 当前展开表的背景色
+static uint8_t g_mono_lut_valid = 0; // 展开表是否已生成
+
+/**
+ * @brief  按两种颜色把 1 位像素展开为大端 RGB565 数据
+ * @param  bits       像素位，bit0 对应第一个像素
+ * @param  count      像素个数 (不超过 32)
+ * @param  color      位为 1 的像素颜色
+ * @param  back_color 位为 0 的像素颜色
+ * @param  dst        输出位置 (count x 2 字节)
+ * @retval 输出结束的位置
+ */
+uint8_t *TFT_Expand_Mono(uint32_t bits, uint8_t count, uint16_t color, uint16_t back_color, uint8_t *dst)
+{
+	if (!g_mono_lut_valid || g_mono_lut_color != color || g_mono_lut_back != back_color)
+	{
+		// 颜色变化: 重新生成 16 项展开表
+		for (uint8_t nibble = 0; nibble < 16; nibble++)
+		{
+			for (uint8_t k = 0; k < 4; k++)
+			{
+				uint16_t pixel = ((nibble >> k) & 0x01) ? color : back_color;
+				g_mono_lut[nibble][k * 2] = pixel >> 8;
+				g_mono_lut[nibble][k * 2 + 1] = pixel & 0xFF;
+			}
+		}
+		g_mono_lut_color = color;
+		g_mono_lut_back = back_color;
+		g_mono_lut_valid = 1;
+	}
+
+	for (; count >= 4; count -= 4, bits >>= 4, dst += 8)
+	{
+		memcpy(dst, g_mono_lut[bits & 0x0F], 8);
+	}
+	memcpy(dst, g_mono_lut[bits & 0x0F], count * 2);
+	return dst + count * 2;
+}
+
+/**
+ * @brief  按两种颜色把 1 位像素展开后写入发送缓冲区
+ * @param  htft       TFT句柄指针
+ * @param  bits       像素位，bit0 对应第一个像素
+ * @param  count      像素个数 (不超过 32)
+ * @param  color      位为 1 的像素颜色
+ * @param  back_color 位为 0 的像素颜色
+ * @retval 无
+ */
+void TFT_Buffer_Write_Mono(TFT_HandleTypeDef *htft, uint32_t bits, uint8_t count, uint16_t color, uint16_t back_color)
+{
+	uint8_t pixels[64]; // 剩余空间不足时的临时展开区
+	uint16_t length = (uint16_t)count * 2;
+	uint16_t avail;
+	uint8_t *dst;
+
+	if (count == 0 || count > 32)
+		return;
+
+	dst = TFT_Buffer_Reserve(htft, &avail);
+	if (dst == NULL)
+		return;
+
+	if (avail >= length)
+	{
+		TFT_Expand_Mono(bits, count, color, back_color, dst);
+		TFT_Buffer_Commit(htft, length);
+		return;
+	}
+
+	// 当前半区放不下: 填满当前半区 (提交时自动发送)，其余写入下一半区
+	TFT_Expand_Mono(bits, count, color, back_color, pixels);
+	memcpy(dst, pixels, avail);
+	TFT_Buffer_Commit(htft, avail);
+	length -= avail;
+	memcpy(TFT_Buffer_Reserve(htft, &avail), pixels + (count * 2 - length), length);
+	TFT_Buffer_Commit(htft, length);
 }
 
 /**
@@ -353,6 +638,8 @@ void TFT_IO_Init(TFT_HandleTypeDef *htft)
 	}
 
 	htft->buffer_write_index = 0; // 初始化缓冲区索引
+	htft->buffer_half = 0;
+	htft->prepared_color_valid = 0;
 
 #ifdef STM32HAL
 	// 检查关联的 SPI 句柄是否配置了 DMA 发送通道
@@ -468,7 +755,9 @@ void TFT_Write_Command(TFT_HandleTypeDef *htft, uint8_t command)
 	// 发送命令前，确保缓冲区中的所有数据已发送完成
 	TFT_Flush_Buffer(htft, 1); // 等待缓冲区刷新完成
 
-	// 不需要再次调用 TFT_Wait_DMA_Transfer_Complete()，因为 Flush_Buffer(1) 已经等待了
+	// 缓冲区为空时 Flush_Buffer 直接返回，此前以非阻塞方式启动的 DMA 可能仍在进行，
+	// 切换 DC 引脚前必须等待其结束
+	TFT_Wait_DMA_Transfer_Complete(htft);
 
 	TFT_Pin_DC_Set(htft, 0); // 设置为命令模式
 	TFT_Pin_CS_Set(htft, 0); // 片选选中
@@ -479,6 +768,28 @@ void TFT_Write_Command(TFT_HandleTypeDef *htft, uint8_t command)
 	TFT_Pin_CS_Set(htft, 1); // 命令发送完成后立即拉高 CS
 }
 
+/**
+ * @brief  向 TFT 写入一对 16 位地址参数 (阻塞方式，内部辅助函数)
+ * @param  htft  TFT句柄指针
+ * @param  start 起始地址
+ * @param  end   结束地址
+ * @retval 无
+ * @note   CASET/RASET 的 4 字节参数一次传输完成，每个窗口少一次 CS 翻转和一次 HAL 调用。
+ */
+static void TFT_Write_Address_Range(TFT_HandleTypeDef *htft, uint16_t start, uint16_t end)
+{
+	uint8_t spi_data[4];
+	spi_data[0] = (start >> 8) & 0xFF;
+	spi_data[1] = start & 0xFF;
+	spi_data[2] = (end >> 8) & 0xFF;
+	spi_data[3] = end & 0xFF;
+
+	TFT_Pin_DC_Set(htft, 1); // 数据模式
+	TFT_Pin_CS_Set(htft, 0); // 片选选中
+	TFT_Platform_SPI_Transmit_Blocking(htft->spi_handle, spi_data, 4, HAL_MAX_DELAY);
+	TFT_Pin_CS_Set(htft, 1);
+}
+
 /**
  * @brief  设置显示区域的地址范围
  * @param  htft TFT句柄指针
@@ -497,19 +808,25 @@ void TFT_Set_Address(TFT_HandleTypeDef *htft, uint16_t x_start, uint16_t y_start
 	// 设置地址前，确保缓冲区中的所有数据已发送完成
 	TFT_Flush_Buffer(htft, 1); // 等待缓冲区刷新完成
 
+	// 上一个窗口是按列填充的，先恢复当前方向的 MADCTL
+	if (htft->madctl_transposed)
+	{
+		TFT_Write_Command(htft, 0x36);
+		TFT_Write_Data8(htft, htft->madctl);
+		htft->madctl_transposed = 0;
+	}
+
 	// --- 设置列地址 (Column Address Set, CASET, 0x2A) ---
 	TFT_Write_Command(htft, 0x2A);
 
 	// 根据屏幕方向和型号设置列地址
 	if (htft->display_direction == 0 || htft->display_direction == 2) // 0°或180°
 	{
-		TFT_Write_Data16(htft, x_start + htft->x_offset);
-		TFT_Write_Data16(htft, x_end + htft->x_offset);
+		TFT_Write_Address_Range(htft, x_start + htft->x_offset, x_end + htft->x_offset);
 	}
 	else // 90°或270°
 	{
-		TFT_Write_Data16(htft, x_start + htft->y_offset);
-		TFT_Write_Data16(htft, x_end + htft->y_offset);
+		TFT_Write_Address_Range(htft, x_start + htft->y_offset, x_end + htft->y_offset);
 	}
 
 	// --- 设置行地址范围 (Set Row Address, 0x2B) ---
@@ -518,13 +835,11 @@ void TFT_Set_Address(TFT_HandleTypeDef *htft, uint16_t x_start, uint16_t y_start
 	// 根据屏幕方向和型号设置行地址
 	if (htft->display_direction == 0 || htft->display_direction == 2) // 0°或180°
 	{
-		TFT_Write_Data16(htft, y_start + htft->y_offset);
-		TFT_Write_Data16(htft, y_end + htft->y_offset);
+		TFT_Write_Address_Range(htft, y_start + htft->y_offset, y_end + htft->y_offset);
 	}
 	else // 90°或270°
 	{
-		TFT_Write_Data16(htft, y_start + htft->x_offset);
-		TFT_Write_Data16(htft, y_end + htft->x_offset);
+		TFT_Write_Address_Range(htft, y_start + htft->x_offset, y_end + htft->x_offset);
 	}
 
 	// --- 发送写 GRAM 命令 (Memory Write, 0x2C) ---
@@ -532,6 +847,56 @@ void TFT_Set_Address(TFT_HandleTypeDef *htft, uint16_t x_start, uint16_t y_start
 	TFT_Write_Command(htft, 0x2C);
 }
 
+/**
+ * @brief  设置按列填充的显示区域地址范围
+ * @param  htft TFT句柄指针
+ * @param  x_start 起始列坐标
+ * @param  y_start 起始行坐标
+ * @param  x_end   结束列坐标
+ * @param  y_end   结束行坐标
+ * @retval 无
+ * @note   翻转 MADCTL 的 MV (行/列交换) 位后，屏幕的列地址对应原来的行，行地址对应原来的列，
+ *         因此以交换后的坐标设置窗口，数据就按 "一列从上到下，再到下一列" 的顺序写入原方向的同一区域。
+ *         MY/MX 作用于物理行/列地址 (ST7735/ST7789 均如此)，只翻转 MV 即为转置。
+ *         连续设置多个按列窗口时 MADCTL 只写一次，之后的 TFT_Set_Address 负责恢复。
+ */
+void TFT_Set_Address_Transposed(TFT_HandleTypeDef *htft, uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end)
+{
+	uint8_t col_offset, row_offset; // 普通窗口中列地址/行地址使用的偏移量
+
+	if (htft == NULL)
+		return;
+
+	// 设置地址前，确保缓冲区中的所有数据已发送完成
+	TFT_Flush_Buffer(htft, 1);
+
+	if (!htft->madctl_transposed)
+	{
+		TFT_Write_Command(htft, 0x36);
+		TFT_Write_Data8(htft, htft->madctl ^ 0x20); // 翻转 MV
+		htft->madctl_transposed = 1;
+	}
+
+	if (htft->display_direction == 0 || htft->display_direction == 2) // 0°或180°
+	{
+		col_offset = htft->x_offset;
+		row_offset = htft->y_offset;
+	}
+	else // 90°或270°
+	{
+		col_offset = htft->y_offset;
+		row_offset = htft->x_offset;
+	}
+
+	// 行列交换: 列地址给出行范围，行地址给出列范围，偏移量随物理方向一起交换
+	TFT_Write_Command(htft, 0x2A);
+	TFT_Write_Address_Range(htft, y_start + row_offset, y_end + row_offset);
+	TFT_Write_Command(htft, 0x2B);
+	TFT_Write_Address_Range(htft, x_start + col_offset, x_end + col_offset);
+
+	TFT_Write_Command(htft, 0x2C);
+}
+
 /**
  * @brief  将RGB颜色值转换为RGB565格式
  * @param  r  红色分量，范围0-255
@@ -0,0 +1,858 @@
+/*
+ * @file    TFT_jpeg.c
+ * @brief   小内存基线 JPEG 解码器
+ * @details 支持基线/扩展顺序 8 位哈夫曼编码 JPEG，灰度或 YCbCr (4:4:4、4:2:2、4:2:0、4:4:0)，支持复位间隔。
+ *          逐个 MCU 解码，工作内存只有 TFT_JPEG_Decoder 结构体 (约 3 KB)。
+ *          反变换使用 12 次乘法的整数 IDCT (LLM 算法)，缩小解码用查表的可分离变换直接计算块平均值。
+ */
+#include "TFTh/TFT_jpeg.h"
+#include <string.h> // 用于 memset/memcpy
+
+#define JPEG_CONST_BITS 13 // IDCT 常数的定点位数
+#define JPEG_PASS1_BITS 2  // 第一遍输出保留的额外精度位
+#define JPEG_DESCALE(x, n) (((x) + ((int32_t)1 << ((n) - 1))) >> (n))
+
+// 之字形扫描顺序 -> 自然顺序
+static const uint8_t _tft_jpeg_zigzag[64] = {
+    0, 1, 8, 16, 9, 2, 3, 10, 17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63};
+
+// 缩小/非方形反变换的系数 (Q13)，边长 N 的 N 行从第 N-1 行开始: [输出位置][频率]
+// 每项为完整 8 点反变换中该输出位置对应的 8/N 个像素的平均值: C(u)/2 * avg(cos((2k+1)u*pi/16))
+static const int16_t _tft_jpeg_idct_table[15][8] = {
+    {2896, 0, 0, 0, 0, 0, 0, 0}, // N = 1
+    {2896, 2624, 0, -922, 0, 616, 0, -522}, // N = 2
+    {2896, -2624, 0, 922, 0, -616, 0, 522},
+    {2896, 3711, 2676, 1303, 0, -871, -1108, -738}, // N = 4
+    {2896, 1537, -2676, -3146, 0, 2102, 1108, -306},
+    {2896, -1537, -2676, 3146, 0, -2102, 1108, 306},
+    {2896, -3711, 2676, -1303, 0, 871, -1108, 738},
+    {2896, 4017, 3784, 3406, 2896, 2276, 1567, 799}, // N = 8
+    {2896, 3406, 1567, -799, -2896, -4017, -3784, -2276},
+    {2896, 2276, -1567, -4017, -2896, 799, 3784, 3406},
+    {2896, 799, -3784, -2276, 2896, 3406, -1567, -4017},
+    {2896, -799, -3784, 2276, 2896, -3406, -1567, 4017},
+    {2896, -2276, -1567, 4017, -2896, -799, 3784, -3406},
+    {2896, -3406, 1567, 799, -2896, 4017, -3784, 2276},
+    {2896, -4017, 3784, -3406, 2896, -2276, 1567, -799}};
+
+//----------------- 输入 -----------------
+
+/**
+ * @brief 读取一个字节
+ * @param dec 解码器
+ * @retval 字节 (数据结束后返回 0 并设置 input_end)
+ */
+static uint8_t _TFT_JPEG_Byte(TFT_JPEG_Decoder *dec)
+{
+    if (dec->input_pos >= dec->input_len)
+    {
+        if (dec->input_end)
+            return 0;
+        dec->input_len = dec->input(dec->input_context, dec->input_buffer, TFT_JPEG_INPUT_SIZE);
+        dec->input_pos = 0;
+        if (dec->input_len == 0)
+        {
+            dec->input_end = 1;
+            return 0;
+        }
+    }
+    return dec->input_buffer[dec->input_pos++];
+}
+
+/**
+ * @brief 读取一个大端 16 位数
+ */
+static uint16_t _TFT_JPEG_Word(TFT_JPEG_Decoder *dec)
+{
+    uint16_t high = _TFT_JPEG_Byte(dec);
+    return (uint16_t)(high << 8) | _TFT_JPEG_Byte(dec);
+}
+
+/**
+ * @brief 跳过若干字节
+ */
+static void _TFT_JPEG_Skip(TFT_JPEG_Decoder *dec, uint16_t length)
+{
+    while (length-- > 0 && !dec->input_end)
+        _TFT_JPEG_Byte(dec);
+}
+
+/**
+ * @brief 从内存读取 JPEG 数据的输入函数
+ * @param context TFT_JPEG_Memory 指针
+ * @param buffer  输出缓冲区
+ * @param length  最多读取的字节数
+ * @retval 实际读取的字节数
+ */
+uint16_t TFT_JPEG_Read_Memory(void *context, uint8_t *buffer, uint16_t length)
+{
+    TFT_JPEG_Memory *source = (TFT_JPEG_Memory *)context;
+    uint32_t remain = source->size - source->pos;
+
+    if (length > remain)
+        length = (uint16_t)remain;
+    memcpy(buffer, source->data + source->pos, length);
+    source->pos += length;
+    return length;
+}
+
+//----------------- 文件头 -----------------
+
+/**
+ * @brief 读取帧头 (SOF0/SOF1)
+ */
+static TFT_JPEG_Result _TFT_JPEG_Read_SOF(TFT_JPEG_Decoder *dec, uint16_t length)
+{
+    if (_TFT_JPEG_Byte(dec) != 8)
+        return TFT_JPEG_ERR_UNSUPPORTED; // 只支持 8 位精度
+
+    dec->height = _TFT_JPEG_Word(dec);
+    dec->width = _TFT_JPEG_Word(dec);
+    dec->component_count = _TFT_JPEG_Byte(dec);
+    if (dec->width == 0 || dec->height == 0)
+        return TFT_JPEG_ERR_UNSUPPORTED; // 高度由 DNL 标记给出
+    if (dec->component_count != 1 && dec->component_count != 3)
+        return TFT_JPEG_ERR_UNSUPPORTED;
+    if (length != 6 + 3 * dec->component_count)
+        return TFT_JPEG_ERR_FORMAT;
+
+    for (uint8_t i = 0; i < dec->component_count; i++)
+    {
+        TFT_JPEG_Component *comp = &dec->components[i];
+        uint8_t sampling;
+
+        comp->id = _TFT_JPEG_Byte(dec);
+        sampling = _TFT_JPEG_Byte(dec);
+        comp->h = sampling >> 4;
+        comp->v = sampling & 0x0F;
+        comp->quant = _TFT_JPEG_Byte(dec);
+        if (comp->quant > 3)
+            return TFT_JPEG_ERR_FORMAT;
+        if (dec->component_count == 1)
+        {
+            comp->h = comp->v = 1; // 单分量扫描不交织，一个 MCU 就是一个块
+        }
+        else if (i == 0 ? (comp->h < 1 || comp->h > 2 || comp->v < 1 || comp->v > 2) : (comp->h != 1 || comp->v != 1))
+        {
+            return TFT_JPEG_ERR_UNSUPPORTED; // 亮度 1~2 倍采样，色度不超过亮度
+        }
+    }
+    dec->max_h = dec->components[0].h;
+    dec->max_v = dec->components[0].v;
+    return TFT_JPEG_OK;
+}
+
+/**
+ * @brief 读取量化表 (DQT)
+ */
+static TFT_JPEG_Result _TFT_JPEG_Read_DQT(TFT_JPEG_Decoder *dec, uint16_t length)
+{
+    while (length > 0)
+    {
+        uint8_t info;
+
+        if (length < 65)
+            return TFT_JPEG_ERR_FORMAT;
+        info = _TFT_JPEG_Byte(dec);
+        if (info >> 4)
+            return TFT_JPEG_ERR_UNSUPPORTED; // 16 位量化表
+        if ((info & 0x0F) > 3)
+            return TFT_JPEG_ERR_FORMAT;
+        for (uint8_t i = 0; i < 64; i++)
+        {
+            dec->quant[info & 0x0F][_tft_jpeg_zigzag[i]] = _TFT_JPEG_Byte(dec);
+        }
+        length -= 65;
+    }
+    return TFT_JPEG_OK;
+}
+
+/**
+ * @brief 读取哈夫曼表 (DHT) 并生成规范哈夫曼码的查找范围
+ */
+static TFT_JPEG_Result _TFT_JPEG_Read_DHT(TFT_JPEG_Decoder *dec, uint16_t length)
+{
+    while (length > 0)
+    {
+        uint8_t counts[16];
+        uint16_t total = 0;
+        uint8_t info;
+        TFT_JPEG_Huffman *table;
+
+        if (length < 17)
+            return TFT_JPEG_ERR_FORMAT;
+        info = _TFT_JPEG_Byte(dec);
+        if ((info >> 4) > 1 || (info & 0x0F) > 1)
+            return TFT_JPEG_ERR_UNSUPPORTED; // 基线只有 2 个 DC 表和 2 个 AC 表
+        table = &dec->huffman[(info >> 4) * 2 + (info & 0x0F)];
+
+        for (uint8_t i = 0; i < 16; i++)
+        {
+            counts[i] = _TFT_JPEG_Byte(dec);
+            total += counts[i];
+        }
+        if (total > sizeof(table->values) || length < 17 + total)
+            return TFT_JPEG_ERR_FORMAT;
+        for (uint16_t i = 0; i < total; i++)
+        {
+            table->values[i] = _TFT_JPEG_Byte(dec);
+        }
+
+        // 同一码长的码连续递增，下一码长从 (上一码长最后的码 + 1) << 1 开始
+        uint16_t code = 0;
+        uint8_t index = 0;
+        for (uint8_t bits = 1; bits <= 16; bits++)
+        {
+            table->offset[bits] = index;
+            table->min_code[bits] = code;
+            code += counts[bits - 1];
+            index += counts[bits - 1];
+            table->max_code[bits] = counts[bits - 1] ? (int32_t)code - 1 : -1;
+            code <<= 1;
+        }
+        length -= 17 + total;
+    }
+    return TFT_JPEG_OK;
+}
+
+/**
+ * @brief 读取扫描头 (SOS)
+ */
+static TFT_JPEG_Result _TFT_JPEG_Read_SOS(TFT_JPEG_Decoder *dec, uint16_t length)
+{
+    uint8_t count = _TFT_JPEG_Byte(dec);
+
+    if (dec->component_count == 0)
+        return TFT_JPEG_ERR_FORMAT; // 没有帧头
+    if (count != dec->component_count)
+        return TFT_JPEG_ERR_UNSUPPORTED; // 分量分别扫描 (非交织) 的多分量图片
+    if (length != 4 + 2 * count)
+        return TFT_JPEG_ERR_FORMAT;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        uint8_t id = _TFT_JPEG_Byte(dec);
+        uint8_t tables = _TFT_JPEG_Byte(dec);
+        TFT_JPEG_Component *comp = NULL;
+
+        for (uint8_t c = 0; c < dec->component_count; c++)
+        {
+            if (dec->components[c].id == id)
+                comp = &dec->components[c];
+        }
+        if (comp == NULL)
+            return TFT_JPEG_ERR_FORMAT;
+        comp->dc_table = tables >> 4;
+        comp->ac_table = tables & 0x0F;
+        if (comp->dc_table > 1 || comp->ac_table > 1)
+            return TFT_JPEG_ERR_UNSUPPORTED;
+    }
+
+    // 频谱选择和逐次逼近: 顺序编码固定为 0, 63, 0
+    if (_TFT_JPEG_Byte(dec) != 0 || _TFT_JPEG_Byte(dec) != 63 || _TFT_JPEG_Byte(dec) != 0)
+        return TFT_JPEG_ERR_UNSUPPORTED;
+
+    dec->bit_buffer = 0;
+    dec->bit_count = 0;
+    dec->marker = 0;
+    return dec->input_end ? TFT_JPEG_ERR_INPUT : TFT_JPEG_OK;
+}
+
+/**
+ * @brief  读取 JPEG 文件头，直到扫描数据开始
+ * @param  dec     解码器工作内存
+ * @param  input   输入函数
+ * @param  context 输入函数的上下文
+ * @retval 解码结果，成功后 dec->width / dec->height 为图片尺寸
+ */
+TFT_JPEG_Result TFT_JPEG_Prepare(TFT_JPEG_Decoder *dec, TFT_JPEG_Input input, void *context)
+{
+    if (dec == NULL || input == NULL)
+        return TFT_JPEG_ERR_FORMAT;
+
+    memset(dec, 0, sizeof(*dec));
+    dec->input = input;
+    dec->input_context = context;
+
+    if (_TFT_JPEG_Byte(dec) != 0xFF || _TFT_JPEG_Byte(dec) != 0xD8)
+        return dec->input_end ? TFT_JPEG_ERR_INPUT : TFT_JPEG_ERR_FORMAT;
+
+    for (;;)
+    {
+        TFT_JPEG_Result result = TFT_JPEG_OK;
+        uint8_t marker;
+        uint16_t length;
+
+        if (_TFT_JPEG_Byte(dec) != 0xFF)
+            return dec->input_end ? TFT_JPEG_ERR_INPUT : TFT_JPEG_ERR_FORMAT;
+        do
+        {
+            marker = _TFT_JPEG_Byte(dec); // 标记前可以有多个填充的 0xFF
+        } while (marker == 0xFF);
+        if (dec->input_end)
+            return TFT_JPEG_ERR_INPUT;
+
+        if (marker == 0xD9)
+            return TFT_JPEG_ERR_FORMAT; // 没有图像数据
+        if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8))
+            continue; // 没有长度字段的标记
+
+        length = _TFT_JPEG_Word(dec);
+        if (length < 2)
+            return TFT_JPEG_ERR_FORMAT;
+        length -= 2;
+
+        switch (marker)
+        {
+        case 0xC0: // SOF0 基线
+        case 0xC1: // SOF1 扩展顺序 (哈夫曼编码)
+            result = _TFT_JPEG_Read_SOF(dec, length);
+            break;
+        case 0xC4:
+            result = _TFT_JPEG_Read_DHT(dec, length);
+            break;
+        case 0xDB:
+            result = _TFT_JPEG_Read_DQT(dec, length);
+            break;
+        case 0xDD:
+            if (length < 2)
+                return TFT_JPEG_ERR_FORMAT;
+            dec->restart_interval = _TFT_JPEG_Word(dec);
+            _TFT_JPEG_Skip(dec, length - 2);
+            break;
+        case 0xDA:
+            return _TFT_JPEG_Read_SOS(dec, length);
+        default:
+            // 其余 SOFn (渐进式、无损、算术编码) 和 DAC 不支持，APPn、COM 等跳过
+            if (marker >= 0xC2 && marker <= 0xCF)
+                return TFT_JPEG_ERR_UNSUPPORTED;
+            _TFT_JPEG_Skip(dec, length);
+            break;
+        }
+        if (result != TFT_JPEG_OK)
+            return result;
+        if (dec->input_end)
+            return TFT_JPEG_ERR_INPUT;
+    }
+}
+
+//----------------- 熵解码 -----------------
+
+/**
+ * @brief 把熵编码数据补充到位缓冲中 (至少 25 位)
+ * @note  去掉 0xFF 后填充的 0x00；遇到标记后停止读取，之后补 0。
+ */
+static void _TFT_JPEG_Fill_Bits(TFT_JPEG_Decoder *dec)
+{
+    while (dec->bit_count <= 24)
+    {
+        uint8_t byte = 0;
+
+        if (!dec->marker)
+        {
+            byte = _TFT_JPEG_Byte(dec);
+            if (byte == 0xFF)
+            {
+                uint8_t next = _TFT_JPEG_Byte(dec);
+
+                while (next == 0xFF)
+                    next = _TFT_JPEG_Byte(dec);
+                if (next != 0x00)
+                {
+                    dec->marker = next; // RSTn 或 EOI
+                    byte = 0;
+                }
+            }
+        }
+        dec->bit_buffer |= (uint32_t)byte << (24 - dec->bit_count);
+        dec->bit_count += 8;
+    }
+}
+
+/**
+ * @brief 读取 n 位 (1~16)
+ */
+static inline uint32_t _TFT_JPEG_Bits(TFT_JPEG_Decoder *dec, uint8_t n)
+{
+    uint32_t value;
+
+    if (dec->bit_count < n)
+        _TFT_JPEG_Fill_Bits(dec);
+    value = dec->bit_buffer >> (32 - n);
+    dec->bit_buffer <<= n;
+    dec->bit_count -= n;
+    return value;
+}
+
+/**
+ * @brief 把 n 位无符号值扩展为有符号系数 (JPEG 的 EXTEND 过程)
+ */
+static inline int16_t _TFT_JPEG_Extend(uint32_t value, uint8_t n)
+{
+    return value < (1u << (n - 1)) ? (int16_t)(value - (1u << n) + 1) : (int16_t)value;
+}
+
+/**
+ * @brief 反量化，结果限制在 -2048~2047 (8 位精度图片的系数范围)，损坏的数据不会让 IDCT 溢出
+ */
+static inline int16_t _TFT_JPEG_Dequant(int32_t value, uint8_t quant)
+{
+    value *= quant;
+    return value < -2048 ? -2048 : (value > 2047 ? 2047 : (int16_t)value);
+}
+
+/**
+ * @brief 解码一个哈夫曼符号
+ * @note  先取 16 位，从短到长比较各码长的最大码值。
+ */
+static uint8_t _TFT_JPEG_Huffman(TFT_JPEG_Decoder *dec, const TFT_JPEG_Huffman *table)
+{
+    uint32_t peek;
+
+    if (dec->bit_count < 16)
+        _TFT_JPEG_Fill_Bits(dec);
+    peek = dec->bit_buffer >> 16;
+
+    for (uint8_t bits = 1; bits <= 16; bits++)
+    {
+        int32_t code = (int32_t)(peek >> (16 - bits));
+
+        if (code <= table->max_code[bits])
+        {
+            dec->bit_buffer <<= bits;
+            dec->bit_count -= bits;
+            return table->values[table->offset[bits] + code - table->min_code[bits]];
+        }
+    }
+
+    // 无效的码: 丢弃 16 位，按 0 处理
+    dec->bit_buffer <<= 16;
+    dec->bit_count -= 16;
+    return 0;
+}
+
+/**
+ * @brief 解码一个块的系数并反量化
+ * @param dec     解码器 (结果在 dec->block，自然顺序)
+ * @param comp    颜色分量
+ * @param dc_only 只需要 DC 系数 (1/8 缩小)，AC 系数只解码不保存
+ */
+static void _TFT_JPEG_Decode_Block(TFT_JPEG_Decoder *dec, TFT_JPEG_Component *comp, uint8_t dc_only)
+{
+    const uint8_t *quant = dec->quant[comp->quant];
+    const TFT_JPEG_Huffman *ac_table = &dec->huffman[2 + comp->ac_table];
+    int16_t *block = dec->block;
+    uint8_t size;
+
+    size = _TFT_JPEG_Huffman(dec, &dec->huffman[comp->dc_table]) & 0x0F; // 损坏的表中可能有大于 15 的值
+    if (size)
+        comp->dc_pred += _TFT_JPEG_Extend(_TFT_JPEG_Bits(dec, size), size);
+
+    if (!dc_only)
+        memset(block, 0, sizeof(dec->block));
+    block[0] = _TFT_JPEG_Dequant(comp->dc_pred, quant[0]);
+
+    for (uint8_t k = 1; k < 64;)
+    {
+        uint8_t symbol = _TFT_JPEG_Huffman(dec, ac_table);
+        uint8_t run = symbol >> 4;
+
+        size = symbol & 0x0F;
+        if (size == 0)
+        {
+            if (run != 15)
+                break; // EOB: 其余系数为 0
+            k += 16;   // ZRL: 16 个 0
+            continue;
+        }
+        k += run;
+        if (k > 63)
+            break;
+
+        uint32_t bits = _TFT_JPEG_Bits(dec, size);
+        if (!dc_only)
+            block[_tft_jpeg_zigzag[k]] = _TFT_JPEG_Dequant(_TFT_JPEG_Extend(bits, size), quant[_tft_jpeg_zigzag[k]]);
+        k++;
+    }
+}
+
+/**
+ * @brief 复位间隔结束: 丢弃剩余位，跳过 RSTn 标记，DC 预测值清零
+ */
+static void _TFT_JPEG_Restart(TFT_JPEG_Decoder *dec)
+{
+    dec->bit_buffer = 0;
+    dec->bit_count = 0;
+
+    // 位读取尚未遇到标记时向后查找
+    while (!dec->marker && !dec->input_end)
+    {
+        if (_TFT_JPEG_Byte(dec) == 0xFF)
+        {
+            uint8_t next = _TFT_JPEG_Byte(dec);
+
+            while (next == 0xFF)
+                next = _TFT_JPEG_Byte(dec);
+            if (next != 0x00)
+                dec->marker = next;
+        }
+    }
+    dec->marker = 0;
+
+    for (uint8_t i = 0; i < dec->component_count; i++)
+    {
+        dec->components[i].dc_pred = 0;
+    }
+}
+
+//----------------- 反变换和颜色转换 -----------------
+
+/**
+ * @brief 限制到 0~255
+ */
+static inline uint8_t _TFT_JPEG_Clamp(int32_t value)
+{
+    return value < 0 ? 0 : (value > 255 ? 255 : (uint8_t)value);
+}
+
+/**
+ * @brief 限制到 16 位 (正常数据的第一遍结果不会超出，损坏的数据不会让第二遍溢出)
+ */
+static inline int32_t _TFT_JPEG_Limit(int32_t value)
+{
+    return value < -32768 ? -32768 : (value > 32767 ? 32767 : value);
+}
+
+/**
+ * @brief 8x8 整数反变换 (LLM 算法，每个一维变换 12 次乘法)
+ * @param block  反量化后的系数 (自然顺序)
+ * @param out    输出采样值
+ * @param stride 输出每行的字节数
+ */
+static void _TFT_JPEG_IDCT8(const int16_t *block, uint8_t *out, uint8_t stride)
+{
+    int32_t work[64];
+
+    // 第一遍: 按列
+    for (uint8_t col = 0; col < 8; col++)
+    {
+        const int16_t *in = block + col;
+        int32_t *ws = work + col;
+        int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+        int32_t z1, z2, z3, z4, z5;
+
+        if (in[8] == 0 && in[16] == 0 && in[24] == 0 && in[32] == 0 && in[40] == 0 && in[48] == 0 && in[56] == 0)
+        {
+            // 只有 DC: 整列相同
+            int32_t dc = (int32_t)in[0] * (1 << JPEG_PASS1_BITS);
+            for (uint8_t i = 0; i < 8; i++)
+                ws[i * 8] = dc;
+            continue;
+        }
+
+        // 偶数部分
+        z2 = in[16];
+        z3 = in[48];
+        z1 = (z2 + z3) * 4433;  // 0.541196100
+        tmp2 = z1 - z3 * 15137; // 1.847759065
+        tmp3 = z1 + z2 * 6270;  // 0.765366865
+        tmp0 = ((int32_t)in[0] + in[32]) * (1 << JPEG_CONST_BITS);
+        tmp1 = ((int32_t)in[0] - in[32]) * (1 << JPEG_CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        // 奇数部分
+        tmp0 = in[56];
+        tmp1 = in[40];
+        tmp2 = in[24];
+        tmp3 = in[8];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        z4 = tmp1 + tmp3;
+        z5 = (z3 + z4) * 9633; // 1.175875602
+        tmp0 *= 2446;          // 0.298631336
+        tmp1 *= 16819;         // 2.053119869
+        tmp2 *= 25172;         // 3.072711026
+        tmp3 *= 12299;         // 1.501321110
+        z1 *= -7373;           // 0.899976223
+        z2 *= -20995;          // 2.562915447
+        z3 = z3 * -16069 + z5; // 1.961570560
+        z4 = z4 * -3196 + z5;  // 0.390180644
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+        ws[0] = _TFT_JPEG_Limit(JPEG_DESCALE(tmp10 + tmp3, JPEG_CONST_BITS - JPEG_PASS1_BITS));
+        ws[56] = _TFT_JPEG_Limit(JPEG_DESCALE(tmp10 - tmp3, JPEG_CONST_BITS - JPEG_PASS1_BITS));
+        ws[8] = _TFT_JPEG_Limit(JPEG_DESCALE(tmp11 + tmp2, JPEG_CONST_BITS - JPEG_PASS1_BITS));
+        ws[48] = _TFT_JPEG_Limit(JPEG_DESCALE(tmp11 - tmp2, JPEG_CONST_BITS - JPEG_PASS1_BITS));
+        ws[16] = _TFT_JPEG_Limit(JPEG_DESCALE(tmp12 + tmp1, JPEG_CONST_BITS - JPEG_PASS1_BITS));
+        ws[40] = _TFT_JPEG_Limit(JPEG_DESCALE(tmp12 - tmp1, JPEG_CONST_BITS - JPEG_PASS1_BITS));
+        ws[24] = _TFT_JPEG_Limit(JPEG_DESCALE(tmp13 + tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS));
+        ws[32] = _TFT_JPEG_Limit(JPEG_DESCALE(tmp13 - tmp0, JPEG_CONST_BITS - JPEG_PASS1_BITS));
+    }
+
+    // 第二遍: 按行，结果加 128 电平偏移
+    for (uint8_t row = 0; row < 8; row++, out += stride)
+    {
+        const int32_t *ws = work + row * 8;
+        int32_t tmp0, tmp1, tmp2, tmp3, tmp10, tmp11, tmp12, tmp13;
+        int32_t z1, z2, z3, z4, z5;
+
+        z2 = ws[2];
+        z3 = ws[6];
+        z1 = (z2 + z3) * 4433;
+        tmp2 = z1 - z3 * 15137;
+        tmp3 = z1 + z2 * 6270;
+        tmp0 = (ws[0] + ws[4]) * (1 << JPEG_CONST_BITS);
+        tmp1 = (ws[0] - ws[4]) * (1 << JPEG_CONST_BITS);
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        tmp0 = ws[7];
+        tmp1 = ws[5];
+        tmp2 = ws[3];
+        tmp3 = ws[1];
+        z1 = tmp0 + tmp3;
+        z2 = tmp1 + tmp2;
+        z3 = tmp0 + tmp2;
+        z4 = tmp1 + tmp3;
+        z5 = (z3 + z4) * 9633;
+        tmp0 *= 2446;
+        tmp1 *= 16819;
+        tmp2 *= 25172;
+        tmp3 *= 12299;
+        z1 *= -7373;
+        z2 *= -20995;
+        z3 = z3 * -16069 + z5;
+        z4 = z4 * -3196 + z5;
+        tmp0 += z1 + z3;
+        tmp1 += z2 + z4;
+        tmp2 += z2 + z3;
+        tmp3 += z1 + z4;
+
+#define JPEG_OUT(x) _TFT_JPEG_Clamp(JPEG_DESCALE(x, JPEG_CONST_BITS + JPEG_PASS1_BITS + 3) + 128)
+        out[0] = JPEG_OUT(tmp10 + tmp3);
+        out[7] = JPEG_OUT(tmp10 - tmp3);
+        out[1] = JPEG_OUT(tmp11 + tmp2);
+        out[6] = JPEG_OUT(tmp11 - tmp2);
+        out[2] = JPEG_OUT(tmp12 + tmp1);
+        out[5] = JPEG_OUT(tmp12 - tmp1);
+        out[3] = JPEG_OUT(tmp13 + tmp0);
+        out[4] = JPEG_OUT(tmp13 - tmp0);
+#undef JPEG_OUT
+    }
+}
+
+/**
+ * @brief 缩小或非方形的反变换: 直接由系数计算 width x height 个输出
+ * @param block  反量化后的系数 (自然顺序)
+ * @param width  输出宽度 (1、2、4、8)
+ * @param height 输出高度 (1、2、4、8)
+ * @param out    输出采样值
+ * @param stride 输出每行的字节数
+ * @note  每个输出等于完整反变换中对应的 (8/width) x (8/height) 个像素的平均值，相当于先解码再按块平均缩小。
+ *        1x1 时就是 DC / 8，不需要 AC 系数。
+ */
+static void _TFT_JPEG_IDCT_Scaled(const int16_t *block, uint8_t width, uint8_t height, uint8_t *out, uint8_t stride)
+{
+    const int16_t(*table_x)[8] = &_tft_jpeg_idct_table[width - 1];
+    const int16_t(*table_y)[8] = &_tft_jpeg_idct_table[height - 1];
+    int32_t work[8][8]; // [频率行][输出列]
+    uint8_t rows = 0;    // 有非零系数的频率行
+
+    if (width == 1 && height == 1)
+    {
+        out[0] = _TFT_JPEG_Clamp(JPEG_DESCALE((int32_t)block[0], 3) + 128);
+        return;
+    }
+
+    // 第一遍: 按行，系数全为 0 的行跳过
+    for (uint8_t v = 0; v < 8; v++)
+    {
+        const int16_t *in = block + v * 8;
+
+        if (in[0] == 0 && in[1] == 0 && in[2] == 0 && in[3] == 0 && in[4] == 0 && in[5] == 0 && in[6] == 0 && in[7] == 0)
+            continue;
+        rows |= 1 << v;
+        for (uint8_t x = 0; x < width; x++)
+        {
+            int32_t sum = 0;
+            for (uint8_t u = 0; u < 8; u++)
+                sum += (int32_t)in[u] * table_x[x][u];
+            work[v][x] = JPEG_DESCALE(sum, JPEG_CONST_BITS - JPEG_PASS1_BITS);
+        }
+    }
+
+    // 第二遍: 按列
+    for (uint8_t y = 0; y < height; y++, out += stride)
+    {
+        for (uint8_t x = 0; x < width; x++)
+        {
+            int32_t sum = 0;
+            for (uint8_t v = 0; v < 8; v++)
+            {
+                if (rows & (1 << v))
+                    sum += work[v][x] * table_y[y][v];
+            }
+            out[x] = _TFT_JPEG_Clamp(JPEG_DESCALE(sum, JPEG_CONST_BITS + JPEG_PASS1_BITS) + 128);
+        }
+    }
+}
+
+/**
+ * @brief 把当前 MCU 的采样值转换为 RGB565 像素
+ * @param dec      解码器
+ * @param size     亮度块的边长 (8 >> scale)
+ * @param chroma_w 色度块的宽度
+ * @param chroma_h 色度块的高度
+ * @param width    输出宽度 (去掉超出图片边界的部分)
+ * @param height   输出高度
+ * @note  R = Y + 1.402 Cr', G = Y - 0.344 Cb' - 0.714 Cr', B = Y + 1.772 Cb' (Q8 整数运算)。
+ *        色度块比 MCU 小时 (只在不缩小的 4:2:x 图片中出现) 按最近邻放大一倍。
+ */
+static void _TFT_JPEG_Convert(TFT_JPEG_Decoder *dec, uint8_t size, uint8_t chroma_w, uint8_t chroma_h,
+                              uint16_t width, uint16_t height)
+{
+    uint16_t luma_stride = dec->max_h * size;
+    uint8_t shift_x = luma_stride > chroma_w;
+    uint8_t shift_y = dec->max_v * size > chroma_h;
+    const uint8_t *cb_plane = dec->samples + luma_stride * dec->max_v * size;
+    const uint8_t *cr_plane = cb_plane + chroma_w * chroma_h;
+    uint8_t *dst = dec->pixels;
+
+    for (uint16_t y = 0; y < height; y++)
+    {
+        const uint8_t *luma = dec->samples + y * luma_stride;
+        const uint8_t *cb_row = cb_plane + (y >> shift_y) * chroma_w;
+        const uint8_t *cr_row = cr_plane + (y >> shift_y) * chroma_w;
+
+        for (uint16_t x = 0; x < width; x++)
+        {
+            int32_t lum = luma[x];
+            int32_t r = lum, g = lum, b = lum;
+            uint16_t pixel;
+
+            if (dec->component_count == 3)
+            {
+                int32_t cb = cb_row[x >> shift_x] - 128;
+                int32_t cr = cr_row[x >> shift_x] - 128;
+
+                r += (359 * cr + 128) >> 8;
+                g -= (88 * cb + 183 * cr + 128) >> 8;
+                b += (454 * cb + 128) >> 8;
+            }
+            pixel = (uint16_t)((_TFT_JPEG_Clamp(r) & 0xF8) << 8) |
+                    (uint16_t)((_TFT_JPEG_Clamp(g) & 0xFC) << 3) |
+                    (_TFT_JPEG_Clamp(b) >> 3);
+            *dst++ = pixel >> 8;
+            *dst++ = pixel & 0xFF;
+        }
+    }
+}
+
+//----------------- 解码 -----------------
+
+/**
+ * @brief  解码图片，每解码一个 MCU 调用一次输出函数
+ * @param  dec     已完成 TFT_JPEG_Prepare 的解码器
+ * @param  scale   缩小比例 (0: 1/1, 1: 1/2, 2: 1/4, 3: 1/8)
+ * @param  output  输出函数
+ * @param  context 输出函数的上下文
+ * @retval 解码结果
+ */
+TFT_JPEG_Result TFT_JPEG_Decompress(TFT_JPEG_Decoder *dec, uint8_t scale, TFT_JPEG_Output output, void *context)
+{
+    uint8_t size = 8 >> scale; // 亮度块输出的边长
+    uint8_t block_w[3], block_h[3];
+    uint16_t mcu_width, mcu_height, mcus_x, mcus_y, out_width, out_height;
+    uint16_t restart_left;
+
+    if (dec == NULL || output == NULL || dec->component_count == 0)
+        return TFT_JPEG_ERR_FORMAT;
+    if (scale > 3)
+        return TFT_JPEG_ERR_UNSUPPORTED;
+
+    // 各分量的块输出尺寸: 色度块覆盖的像素数与 MCU 相同 (最大 8x8)，缩小时不需要再放大色度
+    for (uint8_t c = 0; c < dec->component_count; c++)
+    {
+        block_w[c] = size * dec->max_h / dec->components[c].h;
+        block_h[c] = size * dec->max_v / dec->components[c].v;
+        if (block_w[c] > 8)
+            block_w[c] = 8;
+        if (block_h[c] > 8)
+            block_h[c] = 8;
+    }
+
+    mcu_width = dec->max_h * 8;
+    mcu_height = dec->max_v * 8;
+    mcus_x = (dec->width + mcu_width - 1) / mcu_width;
+    mcus_y = (dec->height + mcu_height - 1) / mcu_height;
+    out_width = (dec->width + (1 << scale) - 1) >> scale;
+    out_height = (dec->height + (1 << scale) - 1) >> scale;
+    restart_left = dec->restart_interval;
+
+    for (uint16_t my = 0; my < mcus_y; my++)
+    {
+        for (uint16_t mx = 0; mx < mcus_x; mx++)
+        {
+            uint8_t *plane = dec->samples;
+            uint16_t x0 = mx * dec->max_h * size;
+            uint16_t y0 = my * dec->max_v * size;
+            uint16_t width = dec->max_h * size;
+            uint16_t height = dec->max_v * size;
+
+            if (dec->restart_interval)
+            {
+                if (restart_left == 0)
+                {
+                    _TFT_JPEG_Restart(dec);
+                    restart_left = dec->restart_interval;
+                }
+                restart_left--;
+            }
+
+            // 依次解码各分量的块，放到该分量的采样平面中
+            for (uint8_t c = 0; c < dec->component_count; c++)
+            {
+                TFT_JPEG_Component *comp = &dec->components[c];
+                uint8_t w = block_w[c], h = block_h[c];
+                uint8_t stride = comp->h * w;
+
+                for (uint8_t by = 0; by < comp->v; by++)
+                {
+                    for (uint8_t bx = 0; bx < comp->h; bx++)
+                    {
+                        uint8_t *out = plane + by * h * stride + bx * w;
+
+                        _TFT_JPEG_Decode_Block(dec, comp, w == 1 && h == 1);
+                        if (w == 8 && h == 8)
+                            _TFT_JPEG_IDCT8(dec->block, out, stride);
+                        else
+                            _TFT_JPEG_IDCT_Scaled(dec->block, w, h, out, stride);
+                    }
+                }
+                plane += comp->h * comp->v * w * h;
+            }
+
+            // 转换颜色并输出 (去掉右边和下边超出图片的部分)
+            if (x0 + width > out_width)
+                width = out_width - x0;
+            if (y0 + height > out_height)
+                height = out_height - y0;
+            _TFT_JPEG_Convert(dec, size, block_w[dec->component_count - 1], block_h[dec->component_count - 1], width, height);
+            output(context, x0, y0, width, height, dec->pixels);
+        }
+    }
+
+    return dec->input_end ? TFT_JPEG_ERR_INPUT : TFT_JPEG_OK;
+}
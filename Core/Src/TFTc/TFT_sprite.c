@@ -0,0 +1,325 @@
+/*
+ * @file    TFT_sprite.c
+ * @brief   TFT屏幕精灵 (可移动的透明色图片)
+ */
+#include "TFTh/TFT_sprite.h"
+#include "TFTh/TFT_io.h"
+#include <string.h> // 用于 memcpy、memset
+
+//----------------- 内部辅助函数 -----------------
+
+/**
+ * @brief 屏幕上的矩形区域 (结束不包含)
+ */
+typedef struct
+{
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+} _TFT_Sprite_Area;
+
+/**
+ * @brief 精灵当前占据的区域
+ */
+static _TFT_Sprite_Area _TFT_Sprite_Bounds(const TFT_Sprite *sprite)
+{
+    _TFT_Sprite_Area area = {sprite->x, sprite->y, (int32_t)sprite->x + sprite->width, (int32_t)sprite->y + sprite->height};
+    return area;
+}
+
+/**
+ * @brief 区域面积
+ */
+static uint32_t _TFT_Sprite_Area_Size(const _TFT_Sprite_Area *area)
+{
+    return (uint32_t)(area->x1 - area->x0) * (uint32_t)(area->y1 - area->y0);
+}
+
+/**
+ * @brief 合成并发送一个区域: 逐行生成背景，再叠加与之相交的精灵
+ * @param htft  TFT句柄指针
+ * @param scene 场景
+ * @param area  屏幕区域 (会与剪裁矩形求交)
+ * @note  像素直接合成在发送缓冲区的当前半区中 (即区域的一个行带)，半区写满时发送，同时合成下一个行带。
+ */
+static void _TFT_Sprite_Render(TFT_HandleTypeDef *htft, const TFT_Sprite_Scene *scene, _TFT_Sprite_Area area)
+{
+    if (area.x0 < htft->clip_x0)
+        area.x0 = htft->clip_x0;
+    if (area.y0 < htft->clip_y0)
+        area.y0 = htft->clip_y0;
+    if (area.x1 > htft->clip_x1)
+        area.x1 = htft->clip_x1;
+    if (area.y1 > htft->clip_y1)
+        area.y1 = htft->clip_y1;
+    if (area.x0 >= area.x1 || area.y0 >= area.y1)
+        return;
+
+    TFT_Set_Address(htft, area.x0, area.y0, area.x1 - 1, area.y1 - 1);
+    TFT_Reset_Buffer(htft);
+
+    for (int32_t y = area.y0; y < area.y1; y++)
+    {
+        int32_t x = area.x0;
+
+        while (x < area.x1)
+        {
+            uint16_t avail;
+            uint8_t *dst = TFT_Buffer_Reserve(htft, &avail);
+            uint16_t count = avail / 2;
+
+            if (dst == NULL)
+                return;
+            if (count > area.x1 - x)
+                count = area.x1 - x;
+
+            if (scene->background != NULL)
+                scene->background(scene->background_context, x, y, count, dst);
+            else
+                memset(dst, 0, count * 2); // 未设置背景函数时按黑色背景处理
+
+            for (uint8_t i = 0; i < scene->count; i++)
+            {
+                const TFT_Sprite *sprite = scene->sprites[i];
+                int32_t x0, x1;
+
+                if (!sprite->visible || y < sprite->y || y >= sprite->y + sprite->height)
+                    continue;
+                x0 = sprite->x > x ? sprite->x : x;
+                x1 = sprite->x + sprite->width < x + count ? sprite->x + sprite->width : x + count;
+                if (x0 >= x1)
+                    continue;
+
+                // 透明色比较按字节进行，数据保持屏幕字节顺序
+                const uint8_t *src = sprite->data + ((uint32_t)(y - sprite->y) * sprite->width + (x0 - sprite->x)) * 2;
+                uint8_t *out = dst + (x0 - x) * 2;
+                uint8_t key_high = sprite->key >> 8;
+                uint8_t key_low = sprite->key & 0xFF;
+
+                for (int32_t n = x1 - x0; n > 0; n--, src += 2, out += 2)
+                {
+                    if (src[0] != key_high || src[1] != key_low)
+                    {
+                        out[0] = src[0];
+                        out[1] = src[1];
+                    }
+                }
+            }
+
+            TFT_Buffer_Commit(htft, count * 2);
+            x += count;
+        }
+    }
+
+    TFT_Flush_Buffer(htft, 0); // 最后一块数据不等待发送完成
+}
+
+/**
+ * @brief 更新两个区域 (精灵的旧位置和新位置)
+ * @note  外接矩形不比两者面积之和大时合并为一个区域，否则 (相距较远) 分别发送。
+ */
+static void _TFT_Sprite_Update(TFT_HandleTypeDef *htft, const TFT_Sprite_Scene *scene,
+                               const _TFT_Sprite_Area *a, const _TFT_Sprite_Area *b)
+{
+    _TFT_Sprite_Area both;
+
+    both.x0 = a->x0 < b->x0 ? a->x0 : b->x0;
+    both.y0 = a->y0 < b->y0 ? a->y0 : b->y0;
+    both.x1 = a->x1 > b->x1 ? a->x1 : b->x1;
+    both.y1 = a->y1 > b->y1 ? a->y1 : b->y1;
+
+    if (_TFT_Sprite_Area_Size(&both) <= _TFT_Sprite_Area_Size(a) + _TFT_Sprite_Area_Size(b))
+    {
+        _TFT_Sprite_Render(htft, scene, both);
+    }
+    else
+    {
+        _TFT_Sprite_Render(htft, scene, *a);
+        _TFT_Sprite_Render(htft, scene, *b);
+    }
+}
+
+//----------------- 背景函数 -----------------
+
+/**
+ * @brief  纯色背景函数
+ * @param  context 指向背景颜色 (uint16_t) 的指针
+ * @param  x       起始列坐标
+ * @param  y       行坐标
+ * @param  width   像素数
+ * @param  pixels  输出 RGB565 像素
+ * @retval 无
+ */
+void TFT_Sprite_Background_Color(void *context, int16_t x, int16_t y, uint16_t width, uint8_t *pixels)
+{
+    uint16_t color = *(const uint16_t *)context;
+
+    while (width-- > 0)
+    {
+        *pixels++ = color >> 8;
+        *pixels++ = color & 0xFF;
+    }
+    (void)x;
+    (void)y;
+}
+
+/**
+ * @brief  位图背景函数
+ * @param  context TFT_Sprite_Bitmap 指针
+ * @param  x       起始列坐标
+ * @param  y       行坐标
+ * @param  width   像素数
+ * @param  pixels  输出 RGB565 像素
+ * @retval 无
+ * @note   位图内的部分整段拷贝，位图以外的部分填充 color。
+ */
+void TFT_Sprite_Background_Bitmap(void *context, int16_t x, int16_t y, uint16_t width, uint8_t *pixels)
+{
+    const TFT_Sprite_Bitmap *bitmap = (const TFT_Sprite_Bitmap *)context;
+    int32_t inside = 0; // 位于位图内的像素数
+
+    // 合成区域已与剪裁矩形求交，x、y 不会为负数
+    if (y < bitmap->height && x < bitmap->width)
+        inside = bitmap->width - x < width ? bitmap->width - x : width;
+    if (inside > 0)
+    {
+        memcpy(pixels, bitmap->data + ((uint32_t)y * bitmap->width + x) * 2, inside * 2);
+        pixels += inside * 2;
+        width -= inside;
+    }
+    TFT_Sprite_Background_Color((void *)&bitmap->color, x + inside, y, width, pixels);
+}
+
+//----------------- 精灵函数 -----------------
+
+/**
+ * @brief  初始化场景
+ * @param  scene      场景
+ * @param  background 背景函数 (NULL 时为黑色背景)
+ * @param  context    背景函数的上下文
+ * @retval 无
+ */
+void TFT_Sprite_Scene_Init(TFT_Sprite_Scene *scene, TFT_Sprite_Background_Func background, void *context)
+{
+    if (scene == NULL)
+        return;
+
+    scene->background = background;
+    scene->background_context = context;
+    scene->count = 0;
+}
+
+/**
+ * @brief  初始化精灵 (初始不显示)
+ * @param  sprite 精灵
+ * @param  data   RGB565 像素 (高字节在前)
+ * @param  width  宽度
+ * @param  height 高度
+ * @param  key    透明色
+ * @retval 无
+ */
+void TFT_Sprite_Init(TFT_Sprite *sprite, const uint8_t *data, uint16_t width, uint16_t height, uint16_t key)
+{
+    if (sprite == NULL)
+        return;
+
+    sprite->data = data;
+    sprite->width = width;
+    sprite->height = height;
+    sprite->key = key;
+    sprite->x = 0;
+    sprite->y = 0;
+    sprite->visible = 0;
+}
+
+/**
+ * @brief  把精灵加入场景，放在最上层
+ * @param  htft   TFT句柄指针
+ * @param  scene  场景
+ * @param  sprite 精灵
+ * @retval 无
+ */
+void TFT_Sprite_Add(TFT_HandleTypeDef *htft, TFT_Sprite_Scene *scene, TFT_Sprite *sprite)
+{
+    if (htft == NULL || scene == NULL || sprite == NULL || scene->count >= TFT_SPRITE_MAX)
+        return;
+
+    scene->sprites[scene->count++] = sprite;
+    if (sprite->visible)
+    {
+        _TFT_Sprite_Area bounds = _TFT_Sprite_Bounds(sprite);
+        _TFT_Sprite_Render(htft, scene, bounds);
+    }
+}
+
+/**
+ * @brief  移动精灵 (未显示时同时显示)
+ * @param  htft   TFT句柄指针
+ * @param  scene  场景
+ * @param  sprite 精灵
+ * @param  x      新的左上角列坐标
+ * @param  y      新的左上角行坐标
+ * @retval 无
+ */
+void TFT_Sprite_Move(TFT_HandleTypeDef *htft, TFT_Sprite_Scene *scene, TFT_Sprite *sprite, int16_t x, int16_t y)
+{
+    _TFT_Sprite_Area old_bounds, new_bounds;
+
+    if (htft == NULL || scene == NULL || sprite == NULL)
+        return;
+
+    old_bounds = _TFT_Sprite_Bounds(sprite);
+    sprite->x = x;
+    sprite->y = y;
+    new_bounds = _TFT_Sprite_Bounds(sprite);
+
+    if (sprite->visible)
+    {
+        _TFT_Sprite_Update(htft, scene, &old_bounds, &new_bounds);
+    }
+    else
+    {
+        sprite->visible = 1;
+        _TFT_Sprite_Render(htft, scene, new_bounds);
+    }
+}
+
+/**
+ * @brief  显示或隐藏精灵
+ * @param  htft    TFT句柄指针
+ * @param  scene   场景
+ * @param  sprite  精灵
+ * @param  visible 1: 显示, 0: 隐藏
+ * @retval 无
+ */
+void TFT_Sprite_Show(TFT_HandleTypeDef *htft, TFT_Sprite_Scene *scene, TFT_Sprite *sprite, uint8_t visible)
+{
+    if (htft == NULL || scene == NULL || sprite == NULL)
+        return;
+    if (sprite->visible == (visible != 0))
+        return;
+
+    sprite->visible = visible != 0;
+    _TFT_Sprite_Render(htft, scene, _TFT_Sprite_Bounds(sprite));
+}
+
+/**
+ * @brief  重绘场景的一个区域
+ * @param  htft   TFT句柄指针
+ * @param  scene  场景
+ * @param  x      区域左上角列坐标
+ * @param  y      区域左上角行坐标
+ * @param  width  区域宽度
+ * @param  height 区域高度
+ * @retval 无
+ */
+void TFT_Sprite_Redraw(TFT_HandleTypeDef *htft, TFT_Sprite_Scene *scene, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+    _TFT_Sprite_Area area = {x, y, (int32_t)x + width, (int32_t)y + height};
+
+    if (htft == NULL || scene == NULL)
+        return;
+
+    _TFT_Sprite_Render(htft, scene, area);
+}
@@ -1,64 +1,1244 @@
 #include "TFTh/TFT_text.h"
 #include "TFTh/TFT_io.h" // 包含绘图函数和 IO 函数
+#include "TFTh/TFT_CAD.h"
 #include "TFTh/font.h"
+#include <stdarg.h> // 用于可变参数
 
 //----------------- 内部辅助函数 -----------------
 
 /**
- * @brief 绘制字模数据到 TFT 屏幕 (支持列行式字库)
- * @param htft TFT句柄指针
+ * @brief 根据字号选择 ASCII 字库
+ * @param size 字体大小 (8, 12, 16, 24，其他值按 8 处理)
+ * @retval 字库指针
+ */
+static const ASCIIFont *_TFT_Select_Font(uint8_t size)
+{
+    if (size == 24)
+        return &afont24x12;
+    if (size == 16)
+        return &afont16x8;
+    if (size == 12)
+        return &afont12x6;
+    return &afont8x6;
+}
+
+/**
+ * @brief 获取 ASCII 字符的字模数据
+ * @param font 字库指针
+ * @param chr  ASCII 字符 (不可显示字符按空格处理)
+ * @retval 指向字模数据的指针
+ */
+static const uint8_t *_TFT_Glyph_Data(const ASCIIFont *font, uint8_t chr)
+{
+    uint16_t bytes_per_char;
+
+    if (font->layout == FONT_LAYOUT_ROW)
+        bytes_per_char = (uint16_t)font->h * ((font->w + 7) / 8);
+    else
+        bytes_per_char = (uint16_t)((font->h + 7) / 8) * font->w;
+
+    // 检查字符是否在可显示范围内
+    if (chr < ' ' || chr > '~')
+        chr = ' '; // 不可显示字符显示为空格
+
+    return font->chars + (chr - ' ') * bytes_per_char;
+}
+
+/**
+ * @brief 取出字模某一行的像素位
+ * @param font  字库指针
+ * @param glyph 字模数据
+ * @param row   行号 (0 ~ h-1)
+ * @retval 该行像素位，bit0 对应最左列 (字宽不超过 32)
+ */
+static uint32_t _TFT_Glyph_Row_Bits(const ASCIIFont *font, const uint8_t *glyph, uint8_t row)
+{
+    uint32_t bits = 0;
+    uint8_t col;
+
+    if (font->layout == FONT_LAYOUT_ROW)
+    {
+        // 逐行式: 一行的字节连续存放，LSB 在左
+        uint8_t bytes_per_row = (font->w + 7) / 8;
+        const uint8_t *src = glyph + row * bytes_per_row;
+        for (col = 0; col < bytes_per_row; col++)
+        {
+            bits |= (uint32_t)src[col] << (col * 8);
+        }
+    }
+    else
+    {
+        // 列行式: 该行所在页的每一列取一位
+        const uint8_t *src = glyph + (row >> 3) * font->w;
+        uint8_t shift = row & 7;
+        for (col = 0; col < font->w; col++)
+        {
+            bits |= (uint32_t)((src[col] >> shift) & 0x01) << col;
+        }
+    }
+    return bits;
+}
+
+/**
+ * @brief 把列行式字模的一列展开为像素 (从上到下)
+ * @param font       字库指针 (FONT_LAYOUT_PAGE)
+ * @param glyph      字模数据
+ * @param col        列号 (0 ~ w-1)
+ * @param color      前景色
+ * @param back_color 背景色
+ * @param dst        输出位置 (h x 2 字节)
+ * @retval 输出结束的位置
+ * @note  列行式字模的一个字节正好是一列中连续的 8 个像素，按字节查表展开，不需要逐行拼出行数据。
+ */
+static uint8_t *_TFT_Glyph_Expand_Column(const ASCIIFont *font, const uint8_t *glyph, uint8_t col,
+                                         uint16_t color, uint16_t back_color, uint8_t *dst)
+{
+    const uint8_t *src = glyph + col;
+
+    for (uint8_t row = 0; row < font->h; row += 8, src += font->w)
+    {
+        dst = TFT_Expand_Mono(*src, font->h - row < 8 ? font->h - row : 8, color, back_color, dst); // 最后一页可能不满 8 行
+    }
+    return dst;
+}
+
+/**
+ * @brief 一段文字中的一个字符
+ */
+typedef struct
+{
+    const ASCIIFont *font; // 字模尺寸和排列方式 (同一段文字的字高必须相同)
+    const uint8_t *glyph;  // 字模数据
+} _TFT_Glyph;
+
+//----------------- 字模缓存 -----------------
+
+#define TFT_GLYPH_CACHE_SLOTS (TFT_GLYPH_CACHE_SIZE / TFT_GLYPH_CACHE_SLOT_SIZE)
+
+#if TFT_GLYPH_CACHE_SLOTS > 0
+
+/**
+ * @brief 字模缓存槽
+ * @note  槽内数据是按 (字模, 前景色, 背景色) 展开好的大端 RGB565 像素，
+ *        可直接作为 DMA 源地址发送，也可拷贝到发送缓冲区。
+ *        像素顺序与字库的排列方式一致: 列行式字库按列展开 (配合按列填充的窗口)，逐行式字库按行展开。
+ */
+typedef struct
+{
+    const uint8_t *glyph;    // 字模数据 (NULL 表示空槽)
+    uint16_t color;          // 前景色
+    uint16_t back_color;     // 背景色
+    uint32_t last_used;      // 最近使用时刻 (LRU 淘汰依据)
+    TFT_HandleTypeDef *htft; // 最近一次直接从该槽 DMA 发送的屏幕 (淘汰前需等待其传输完成)
+} _TFT_Glyph_Cache_Slot;
+
+static _TFT_Glyph_Cache_Slot _tft_glyph_cache[TFT_GLYPH_CACHE_SLOTS];
+static uint8_t _tft_glyph_cache_data[TFT_GLYPH_CACHE_SLOTS][TFT_GLYPH_CACHE_SLOT_SIZE];
+static uint32_t _tft_glyph_cache_clock; // 使用计数，每次查找加 1
+
+/**
+ * @brief 查找或生成展开后的字模
+ * @param font       字模尺寸和排列方式
+ * @param glyph      字模数据 (同时作为缓存键)
+ * @param color      前景色
+ * @param back_color 背景色
+ * @param pin_from   使用时刻不早于此值的槽不会被淘汰 (保护同一段文字中已取得的字模)
+ * @retval 缓存槽序号，字模超过槽大小或没有可淘汰的槽时返回 -1
+ */
+static int16_t _TFT_Glyph_Cache_Get(const ASCIIFont *font, const uint8_t *glyph,
+                                    uint16_t color, uint16_t back_color, uint32_t pin_from)
+{
+    int16_t victim = -1;
+    uint8_t *dst;
+
+    if ((uint16_t)font->w * font->h * 2 > TFT_GLYPH_CACHE_SLOT_SIZE)
+        return -1;
+
+    _tft_glyph_cache_clock++;
+    for (int16_t i = 0; i < TFT_GLYPH_CACHE_SLOTS; i++)
+    {
+        _TFT_Glyph_Cache_Slot *slot = &_tft_glyph_cache[i];
+
+        if (slot->glyph == glyph && slot->color == color && slot->back_color == back_color)
+        {
+            slot->last_used = _tft_glyph_cache_clock;
+            return i; // 命中
+        }
+        if (slot->last_used < pin_from &&
+            (victim < 0 || slot->last_used < _tft_glyph_cache[victim].last_used))
+        {
+            victim = i;
+        }
+    }
+    if (victim < 0)
+        return -1;
+
+    // 该槽可能仍是某次 DMA 传输的数据源，覆盖前等待传输结束
+    _TFT_Glyph_Cache_Slot *slot = &_tft_glyph_cache[victim];
+    if (slot->htft != NULL)
+    {
+        while (slot->htft->is_dma_transfer_active)
+        {
+        }
+        slot->htft = NULL;
+    }
+
+    dst = _tft_glyph_cache_data[victim];
+    if (font->layout == FONT_LAYOUT_PAGE)
+    {
+        for (uint8_t col = 0; col < font->w; col++)
+        {
+            dst = _TFT_Glyph_Expand_Column(font, glyph, col, color, back_color, dst);
+        }
+    }
+    else
+    {
+        for (uint8_t row = 0; row < font->h; row++)
+        {
+            dst = TFT_Expand_Mono(_TFT_Glyph_Row_Bits(font, glyph, row), font->w, color, back_color, dst);
+        }
+    }
+
+    slot->glyph = glyph;
+    slot->color = color;
+    slot->back_color = back_color;
+    slot->last_used = _tft_glyph_cache_clock;
+    return victim;
+}
+
+#endif /* TFT_GLYPH_CACHE_SLOTS > 0 */
+
+/**
+ * @brief 把一段像素数据写入发送缓冲区 (剩余空间不足时分多次)
+ * @param htft   TFT句柄指针
+ * @param dst    当前写入位置 (随写入更新)
+ * @param avail  当前申请到的剩余空间 (随写入更新)
+ * @param used   当前申请到的空间中已写入的字节数 (随写入更新)
+ * @param src    像素数据
+ * @param length 字节数
+ * @retval 1: 成功, 0: 缓冲区不可用
+ */
+static uint8_t _TFT_Run_Write(TFT_HandleTypeDef *htft, uint8_t **dst, uint16_t *avail, uint16_t *used,
+                              const uint8_t *src, uint16_t length)
+{
+    while (length)
+    {
+        uint16_t chunk;
+
+        if (*avail == 0)
+        {
+            if (*used != 0)
+                TFT_Buffer_Commit(htft, *used);
+            *dst = TFT_Buffer_Reserve(htft, avail);
+            *used = 0;
+            if (*dst == NULL)
+                return 0;
+        }
+        chunk = length < *avail ? length : *avail;
+        memcpy(*dst, src, chunk);
+        *dst += chunk;
+        src += chunk;
+        length -= chunk;
+        *avail -= chunk;
+        *used += chunk;
+    }
+    return 1;
+}
+
+/**
+ * @brief 在一个地址窗口内绘制一串字符 (背景不透明)
+ * @param htft       TFT句柄指针
  * @param x          起始列坐标
  * @param y          起始行坐标
- * @param glyph_data 指向字模数据的指针 (列行式)
- * @param width      字符宽度
- * @param height     字符高度
+ * @param glyphs     各字符的字模 (不超过 TFT_TEXT_RUN_MAX 个，字高相同，字宽可以不同)
+ * @param count      字符数量
  * @param color      字符颜色
  * @param back_color 背景颜色
- * @param mode       模式 (0: 背景不透明, 1: 背景透明)
+ * @param scale      放大倍数 (1 为原始大小)，每个字模位展开为 scale x scale 个像素
+ * @note  窗口覆盖整段文字，像素直接写入发送缓冲区，整段文字只需一次窗口设置和一次连续的 DMA 数据流。
+ *        最后一块数据不等待发送完成。
+ *        全部是列行式字模且不放大时，使用按列填充的窗口 (TFT_Set_Address_Transposed)，
+ *        字模字节按存放顺序逐列展开，每 4 位查表输出 4 个像素；否则逐扫描线依次输出所有字符的同一行。
+ *        缓存中已展开的字模整段 (按列) 或按行拷贝；单个字符命中缓存时直接以缓存数据为 DMA 源发送。
+ *        放大时每一位在输出时展开为 scale 个像素，每行重复输出 scale 次，不使用缓存。
  */
-static void _TFT_Draw_Glyph(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *glyph_data,
-                            uint8_t width, uint8_t height,
-                            uint16_t color, uint16_t back_color, uint8_t mode)
+static void _TFT_Draw_Glyph_Run(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y,
+                                const _TFT_Glyph glyphs[], uint8_t count,
+                                uint16_t color, uint16_t back_color, uint8_t scale)
 {
-    uint16_t col, row;
-    uint8_t byte, bit;
-    uint8_t bytes_per_column = (height + 7) / 8; // 每列字节数（8行=1, 12行=2）
+    const uint8_t *pixels[TFT_TEXT_RUN_MAX]; // 已展开的像素数据，NULL 表示逐位展开
+    uint8_t line_buffer[64];                 // 缓冲区剩余空间不足一行/一列时的展开位置 (字宽、字高不超过 32)
+    uint16_t width = 0;
+    uint8_t height;
+    uint8_t columns = (scale == 1); // 是否按列输出
+    uint8_t fg_high = color >> 8, fg_low = color & 0xFF;
+    uint8_t bg_high = back_color >> 8, bg_low = back_color & 0xFF;
+    uint8_t *dst = NULL;
+    uint16_t avail = 0; // 当前申请到的剩余空间 (字节)
+    uint16_t used = 0;  // 当前申请到的空间中已写入的字节数
 
-    TFT_Set_Address(htft, x, y, x + width - 1, y + height - 1);
-    TFT_Reset_Buffer(htft);
+    if (count == 0)
+        return;
+    height = glyphs[0].font->h;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (glyphs[i].font->layout != FONT_LAYOUT_PAGE)
+            columns = 0;
+    }
+
+#if TFT_GLYPH_CACHE_SLOTS > 0
+    uint32_t pin_from = _tft_glyph_cache_clock + 1;
+#endif
+    for (uint8_t i = 0; i < count; i++)
+    {
+        const ASCIIFont *font = glyphs[i].font;
+
+        width += font->w;
+        pixels[i] = NULL;
+#if TFT_GLYPH_CACHE_SLOTS > 0
+        // 缓存按字库的排列方式展开，只在输出顺序一致时使用
+        if (scale != 1 || (font->layout == FONT_LAYOUT_PAGE) != columns)
+            continue;
+
+        int16_t slot = _TFT_Glyph_Cache_Get(font, glyphs[i].glyph, color, back_color, pin_from);
+        if (slot >= 0)
+        {
+            pixels[i] = _tft_glyph_cache_data[slot];
+            if (count == 1)
+            {
+                // 单个字符: 缓存数据直接作为 DMA 源，不经过发送缓冲区
+                if (columns)
+                    TFT_Set_Address_Transposed(htft, x, y, x + font->w - 1, y + font->h - 1);
+                else
+                    TFT_Set_Address(htft, x, y, x + font->w - 1, y + font->h - 1);
+                TFT_SPI_Send(htft, _tft_glyph_cache_data[slot], (uint16_t)font->w * font->h * 2, 0);
+                _tft_glyph_cache[slot].htft = htft;
+                return;
+            }
+        }
+#endif
+    }
+
+    if (columns)
+    {
+        // 按列输出: 一个字符的数据在窗口中连续，逐字符整段拷贝或逐列展开
+        uint16_t column_bytes = (uint16_t)height * 2;
+
+        TFT_Set_Address_Transposed(htft, x, y, x + width - 1, y + height - 1);
+        TFT_Reset_Buffer(htft);
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const ASCIIFont *font = glyphs[i].font;
+
+            if (pixels[i] != NULL)
+            {
+                if (!_TFT_Run_Write(htft, &dst, &avail, &used, pixels[i], font->w * column_bytes))
+                    return;
+                continue;
+            }
 
-    // 按列优先处理（匹配逐行式字库）
-    for (col = 0; col < width; col++)
-    { // 先遍历列
-        for (uint8_t byte_idx = 0; byte_idx < bytes_per_column; byte_idx++)
-        { // 每列的字节
-            byte = glyph_data[col * bytes_per_column + byte_idx];
-            for (row = 0; row < 8; row++)
-            {                                            // 遍历当前字节的8位
-                uint16_t pixel_row = byte_idx * 8 + row; // 计算实际行号
-                if (pixel_row >= height)
-                    break; // 防止越界
-
-                // 关键修改：选择正确的位顺序（尝试两种方式）左右翻转请修改它
-                // bit = (byte >> (7 - row)) & 0x01; // 方式1：MSB在上（常见）
-                bit = (byte >> row) & 0x01; // 方式2：LSB在上
-
-                if (bit)
+            for (uint8_t col = 0; col < font->w; col++)
+            {
+                if (avail >= column_bytes)
+                {
+                    // 空间足够: 直接展开到发送缓冲区
+                    _TFT_Glyph_Expand_Column(font, glyphs[i].glyph, col, color, back_color, dst);
+                    dst += column_bytes;
+                    avail -= column_bytes;
+                    used += column_bytes;
+                }
+                else
                 {
-                    TFT_Buffer_Write16(htft, color); // 前景色
+                    _TFT_Glyph_Expand_Column(font, glyphs[i].glyph, col, color, back_color, line_buffer);
+                    if (!_TFT_Run_Write(htft, &dst, &avail, &used, line_buffer, column_bytes))
+                        return;
                 }
-                else if (mode == 0)
+            }
+        }
+
+        TFT_Buffer_Commit(htft, used);
+        TFT_Flush_Buffer(htft, 0);
+        return;
+    }
+
+    TFT_Set_Address(htft, x, y, x + width * scale - 1, y + (uint16_t)height * scale - 1);
+    TFT_Reset_Buffer(htft);
+
+    for (uint16_t line = 0; line < (uint16_t)height * scale; line++)
+    {
+        uint8_t row = line / scale;
+
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const ASCIIFont *font = glyphs[i].font;
+            uint16_t row_bytes = (uint16_t)font->w * 2;
+
+            if (pixels[i] != NULL)
+            {
+                // 已展开: 整行拷贝
+                if (!_TFT_Run_Write(htft, &dst, &avail, &used, pixels[i] + row * row_bytes, row_bytes))
+                    return;
+                continue;
+            }
+
+            uint32_t bits = _TFT_Glyph_Row_Bits(font, glyphs[i].glyph, row);
+
+            if (scale == 1)
+            {
+                // 不放大: 每 4 位查表展开
+                if (avail >= row_bytes)
                 {
-                    TFT_Buffer_Write16(htft, back_color); // 背景色
+                    TFT_Expand_Mono(bits, font->w, color, back_color, dst);
+                    dst += row_bytes;
+                    avail -= row_bytes;
+                    used += row_bytes;
                 }
                 else
                 {
-                    // 透明模式（需硬件支持）
+                    TFT_Expand_Mono(bits, font->w, color, back_color, line_buffer);
+                    if (!_TFT_Run_Write(htft, &dst, &avail, &used, line_buffer, row_bytes))
+                        return;
+                }
+                continue;
+            }
+
+            for (uint8_t col = 0; col < font->w; col++)
+            {
+                uint8_t high = (bits & 0x01) ? fg_high : bg_high; // 前景色/背景色
+                uint8_t low = (bits & 0x01) ? fg_low : bg_low;
+
+                bits >>= 1;
+                for (uint8_t k = 0; k < scale; k++)
+                {
+                    if (avail == 0)
+                    {
+                        if (used != 0)
+                            TFT_Buffer_Commit(htft, used);
+                        dst = TFT_Buffer_Reserve(htft, &avail);
+                        used = 0;
+                        if (dst == NULL)
+                            return;
+                    }
+
+                    *dst++ = high;
+                    *dst++ = low;
+                    avail -= 2;
+                    used += 2;
+                }
+            }
+        }
+    }
+
+    TFT_Buffer_Commit(htft, used);
+    TFT_Flush_Buffer(htft, 0);
+}
+
+/**
+ * @brief 以水平线段形式绘制一个字符的前景像素 (背景透明)
+ * @param sink  水平线段汇集器 (已用字符颜色开始)
+ * @param x     起始列坐标
+ * @param y     起始行坐标
+ * @param font  字库指针
+ * @param glyph 字模数据
+ * @param scale 放大倍数 (1 为原始大小)
+ * @note  每行连续的点亮像素合并为一条线段，只写入前景像素，背景保持屏幕原有内容。
+ *        上下多行相同的线段 (如竖笔画、放大后重复的行) 由汇集器合并为一个矩形。
+ */
+static void _TFT_Draw_Glyph_Transparent(TFT_Span_Sink *sink, uint16_t x, uint16_t y, const ASCIIFont *font,
+                                        const uint8_t *glyph, uint8_t scale)
+{
+    for (uint8_t row = 0; row < font->h; row++)
+    {
+        uint32_t bits = _TFT_Glyph_Row_Bits(font, glyph, row);
+        uint8_t col = 0;
+
+        while (bits)
+        {
+            uint8_t start;
+
+            // 跳过背景像素
+            while (!(bits & 0x01))
+            {
+                bits >>= 1;
+                col++;
+            }
+            // 统计连续的前景像素
+            start = col;
+            while (bits & 0x01)
+            {
+                bits >>= 1;
+                col++;
+            }
+            for (uint8_t k = 0; k < scale; k++)
+            {
+                TFT_Span_Add(sink, (int16_t)(x + start * scale), (int16_t)(y + row * scale + k),
+                             (int16_t)((col - start) * scale));
+            }
+        }
+    }
+}
+
+/**
+ * @brief 解码一个 UTF-8 字符
+ * @param str 字符串指针
+ * @param key 输出键: 该字符的 UTF-8 字节按大端拼成 32 位，不足 4 字节补 0 (与字库前 4 字节一致)，
+ *            非法序列输出 0
+ * @retval 该字符占用的字节数 (非法序列按已检查的字节数跳过，至少为 1)
+ * @note  UTF-8 的字节序与码点顺序一致，因此键的大小顺序就是码点顺序。
+ */
+static uint8_t _TFT_UTF8_Decode(const uint8_t *str, uint32_t *key)
+{
+    uint8_t len;
+
+    if (str[0] < 0x80)
+        len = 1;
+    else if ((str[0] & 0xE0) == 0xC0)
+        len = 2;
+    else if ((str[0] & 0xF0) == 0xE0)
+        len = 3;
+    else if ((str[0] & 0xF8) == 0xF0)
+        len = 4;
+    else
+    {
+        *key = 0; // 孤立的后续字节或非法首字节
+        return 1;
+    }
+
+    *key = 0;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        uint8_t byte = 0;
+
+        if (i < len)
+        {
+            byte = str[i];
+            if (i > 0 && (byte & 0xC0) != 0x80)
+            {
+                *key = 0; // 序列被截断 (包括遇到字符串结尾)
+                return i;
+            }
+        }
+        *key = (*key << 8) | byte;
+    }
+    return len;
+}
+
+/**
+ * @brief 在字库中查找字符
+ * @param font 字库指针
+ * @param key  字符的 UTF-8 键 (见 _TFT_UTF8_Decode)
+ * @retval 字模数据指针，未找到返回 NULL
+ * @note  字库提供排序索引时二分查找，否则顺序查找。
+ */
+static const uint8_t *_TFT_Font_Find(const Font *font, uint32_t key)
+{
+    uint16_t stride = 4 + (uint16_t)((font->h + 7) / 8) * font->w; // 每个字: 4 字节编码 + 字模
+    const uint8_t *entry;
+    uint32_t entry_key;
+
+    if (font->index != NULL)
+    {
+        uint16_t low = 0, high = font->len;
+
+        while (low < high)
+        {
+            uint16_t mid = (low + high) / 2;
+
+            entry = font->chars + font->index[mid] * stride;
+            entry_key = ((uint32_t)entry[0] << 24) | ((uint32_t)entry[1] << 16) | ((uint32_t)entry[2] << 8) | entry[3];
+            if (entry_key == key)
+                return entry + 4;
+            if (entry_key < key)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        return NULL;
+    }
+
+    for (uint16_t i = 0; i < font->len; i++)
+    {
+        entry = font->chars + i * stride;
+        entry_key = ((uint32_t)entry[0] << 24) | ((uint32_t)entry[1] << 16) | ((uint32_t)entry[2] << 8) | entry[3];
+        if (entry_key == key)
+            return entry + 4;
+    }
+    return NULL;
+}
+
+//----------------- 比例字体 -----------------
+
+/**
+ * @brief 比例字体字模解码器 (每个字一个，逐行读出包围盒内的像素)
+ */
+typedef struct
+{
+    const uint8_t *data; // 当前字节
+    uint8_t bit;         // 当前字节中的位序号
+    uint16_t row;        // 上一行的像素 (重复行直接使用)
+} _TFT_Prop_Decoder;
+
+/**
+ * @brief 比例字体一段文字中的一个字
+ */
+typedef struct
+{
+    const PropGlyph *glyph;    // 字表项
+    int16_t left;              // 包围盒左边相对窗口的列坐标
+    _TFT_Prop_Decoder decoder; // 字模解码器
+} _TFT_Prop_Item;
+
+/**
+ * @brief 从位流中读出若干位 (LSB 在前)
+ * @param dec   解码器
+ * @param count 位数 (不超过 16)
+ * @retval 读出的值，先读出的位在低位
+ */
+static uint16_t _TFT_Prop_Read_Bits(_TFT_Prop_Decoder *dec, uint8_t count)
+{
+    uint16_t value = 0;
+
+    for (uint8_t i = 0; i < count;)
+    {
+        uint8_t take = 8 - dec->bit; // 当前字节中剩余的位数
+
+        if (take > count - i)
+            take = count - i;
+        value |= (uint16_t)((*dec->data >> dec->bit) & ((1 << take) - 1)) << i;
+        i += take;
+        dec->bit += take;
+        if (dec->bit == 8)
+        {
+            dec->bit = 0;
+            dec->data++;
+        }
+    }
+    return value;
+}
+
+/**
+ * @brief 读出下一行像素
+ * @param dec   解码器
+ * @param width 包围盒宽度
+ * @param first 是否为包围盒第一行
+ * @retval 该行像素，第 n 位为包围盒第 n 列
+ */
+static uint16_t _TFT_Prop_Next_Row(_TFT_Prop_Decoder *dec, uint8_t width, uint8_t first)
+{
+    if (first || _TFT_Prop_Read_Bits(dec, 1) == 0)
+        dec->row = _TFT_Prop_Read_Bits(dec, width);
+    return dec->row;
+}
+
+/**
+ * @brief 获取字符对应的字表项
+ * @param font 比例字体
+ * @param chr  字符 (超出字体范围时使用第一个字符)
+ * @retval 字表项指针
+ */
+static const PropGlyph *_TFT_Prop_Glyph(const PropFont *font, uint8_t chr)
+{
+    if (chr < font->first || chr > font->last)
+        chr = font->first;
+    return &font->glyphs[chr - font->first];
+}
+
+/**
+ * @brief 查找两个字符之间的字距调整 (二分查找)
+ * @param font  比例字体
+ * @param left  左侧字符
+ * @param right 右侧字符
+ * @retval 步进修正 (像素)
+ */
+static int8_t _TFT_Prop_Kerning(const PropFont *font, uint8_t left, uint8_t right)
+{
+    uint16_t key = ((uint16_t)left << 8) | right;
+    uint16_t low = 0, high = font->kerning_len;
+
+    if (font->kerning == NULL)
+        return 0;
+
+    while (low < high)
+    {
+        uint16_t mid = (low + high) / 2;
+        uint16_t mid_key = ((uint16_t)font->kerning[mid].left << 8) | font->kerning[mid].right;
+
+        if (mid_key == key)
+            return font->kerning[mid].adjust;
+        if (mid_key < key)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return 0;
+}
+
+/**
+ * @brief 在一个地址窗口内绘制一段比例字体文字
+ * @param htft       TFT句柄指针
+ * @param x          窗口左边列坐标 (第一个字的笔位置)
+ * @param y          行顶部坐标
+ * @param font       比例字体
+ * @param items      各字的字表项和位置 (解码器在此初始化)
+ * @param count      字数
+ * @param width      窗口宽度 (超过 TFT_MAX_WIDTH 的部分不绘制)
+ * @param color      字符颜色
+ * @param back_color 背景颜色
+ * @param sink       背景透明时的水平线段汇集器，为 NULL 时背景不透明
+ * @note  逐扫描线把各字当前行的像素解码进栈上的一行位掩码 (相邻字的包围盒可以因字距调整重叠)，
+ *        背景不透明时把该行像素直接写入发送缓冲区，整段只设置一次窗口；
+ *        背景透明时把该行连续的前景像素交给汇集器。
+ */
+static void _TFT_Draw_Prop_Run(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const PropFont *font,
+                               _TFT_Prop_Item items[], uint8_t count, uint16_t width,
+                               uint16_t color, uint16_t back_color, TFT_Span_Sink *sink)
+{
+    uint8_t fg_high = color >> 8, fg_low = color & 0xFF;
+    uint8_t bg_high = back_color >> 8, bg_low = back_color & 0xFF;
+    uint8_t mask[(TFT_MAX_WIDTH + 7) / 8]; // 本行各像素是否为前景
+    uint8_t *dst = NULL;
+    uint16_t avail = 0; // 当前申请到的剩余空间 (字节)
+    uint16_t used = 0;  // 当前申请到的空间中已写入的字节数
+
+    if (count == 0 || width == 0)
+        return;
+    if (width > TFT_MAX_WIDTH)
+        width = TFT_MAX_WIDTH; // 超出部分已在屏幕外
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        _TFT_Prop_Decoder *dec = &items[i].decoder;
+
+        dec->data = font->bitmap + PROP_GLYPH_OFFSET(items[i].glyph);
+        dec->bit = 0;
+        dec->row = 0;
+    }
+
+    if (sink == NULL)
+    {
+        TFT_Set_Address(htft, x, y, x + width - 1, y + font->h - 1);
+        TFT_Reset_Buffer(htft);
+    }
+
+    for (uint8_t row = 0; row < font->h; row++)
+    {
+        memset(mask, 0, (width + 7) / 8);
+
+        // 解码各字在本行的像素
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const PropGlyph *glyph = items[i].glyph;
+            uint8_t glyph_width = PROP_GLYPH_WIDTH(glyph);
+            uint8_t top = PROP_GLYPH_Y_OFFSET(glyph);
+            uint16_t pixels;
+
+            if (glyph_width == 0 || row < top || row >= top + PROP_GLYPH_HEIGHT(glyph))
+                continue;
+            pixels = _TFT_Prop_Next_Row(&items[i].decoder, glyph_width, row == top);
+            for (int16_t px = items[i].left; pixels != 0; pixels >>= 1, px++)
+            {
+                if ((pixels & 1) && px >= 0 && px < (int16_t)width)
+                    mask[px >> 3] |= 1 << (px & 7);
+            }
+        }
+
+        if (sink != NULL)
+        {
+            // 背景透明: 连续的前景像素作为一条线段
+            uint16_t col = 0;
+
+            while (col < width)
+            {
+                uint16_t start;
+
+                while (col < width && !(mask[col >> 3] & (1 << (col & 7))))
+                    col++;
+                start = col;
+                while (col < width && (mask[col >> 3] & (1 << (col & 7))))
+                    col++;
+                if (col > start)
+                    TFT_Span_Add(sink, (int16_t)(x + start), (int16_t)(y + row), (int16_t)(col - start));
+            }
+            continue;
+        }
+
+        for (uint16_t col = 0; col < width; col++)
+        {
+            if (avail == 0)
+            {
+                if (used != 0)
+                    TFT_Buffer_Commit(htft, used);
+                dst = TFT_Buffer_Reserve(htft, &avail);
+                used = 0;
+                if (dst == NULL)
+                    return;
+            }
+
+            if (mask[col >> 3] & (1 << (col & 7)))
+            {
+                *dst++ = fg_high; // 前景色
+                *dst++ = fg_low;
+            }
+            else
+            {
+                *dst++ = bg_high; // 背景色
+                *dst++ = bg_low;
+            }
+            avail -= 2;
+            used += 2;
+        }
+    }
+
+    if (sink == NULL)
+    {
+        TFT_Buffer_Commit(htft, used);
+        TFT_Flush_Buffer(htft, 0);
+    }
+}
+
+//----------------- 抗锯齿字体 -----------------
+
+static uint8_t _tft_aa_ramp[16][2];  // 各灰度级对应的大端 RGB565 颜色
+static uint16_t _tft_aa_ramp_color;  // 当前色阶表的前景色
+static uint16_t _tft_aa_ramp_back;   // 当前色阶表的背景色
+static uint8_t _tft_aa_ramp_bpp = 0; // 当前色阶表的每像素位数 (0 表示尚未生成)
+
+/**
+ * @brief 生成前景色到背景色的色阶表
+ * @param color      前景色
+ * @param back_color 背景色
+ * @param bpp        每像素位数 (2 或 4)
+ * @note  与上一次的颜色和位数相同时直接复用，绘制时每像素只需查一次表。
+ */
+static void _TFT_AA_Build_Ramp(uint16_t color, uint16_t back_color, uint8_t bpp)
+{
+    uint8_t levels = (1 << bpp) - 1;
+    int16_t fr = color >> 11, fg = (color >> 5) & 0x3F, fb = color & 0x1F;
+    int16_t br = back_color >> 11, bg = (back_color >> 5) & 0x3F, bb = back_color & 0x1F;
+
+    if (bpp == _tft_aa_ramp_bpp && color == _tft_aa_ramp_color && back_color == _tft_aa_ramp_back)
+        return;
+
+    for (uint8_t i = 0; i <= levels; i++)
+    {
+        // 各通道按覆盖率线性插值 (四舍五入)
+        uint16_t r = br + ((fr - br) * i * 2 + (fr >= br ? levels : -levels)) / (levels * 2);
+        uint16_t g = bg + ((fg - bg) * i * 2 + (fg >= bg ? levels : -levels)) / (levels * 2);
+        uint16_t b = bb + ((fb - bb) * i * 2 + (fb >= bb ? levels : -levels)) / (levels * 2);
+        uint16_t pixel = (r << 11) | (g << 5) | b;
+
+        _tft_aa_ramp[i][0] = pixel >> 8;
+        _tft_aa_ramp[i][1] = pixel & 0xFF;
+    }
+    _tft_aa_ramp_color = color;
+    _tft_aa_ramp_back = back_color;
+    _tft_aa_ramp_bpp = bpp;
+}
+
+/**
+ * @brief 在一个地址窗口内绘制一段抗锯齿文字
+ * @param htft   TFT句柄指针
+ * @param x      起始列坐标
+ * @param y      起始行坐标
+ * @param font   抗锯齿字体
+ * @param glyphs 各字的字模数据
+ * @param count  字数
+ * @note  调用前须已生成色阶表。逐扫描线输出所有字的同一行，每像素查一次色阶表。
+ */
+static void _TFT_Draw_AA_Run(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const AAFont *font,
+                             const uint8_t *const glyphs[], uint8_t count)
+{
+    uint16_t row_bytes = ((uint16_t)font->w * font->bpp + 7) / 8;
+    uint8_t mask = (1 << font->bpp) - 1;
+    uint8_t *dst = NULL;
+    uint16_t avail = 0; // 当前申请到的剩余空间 (字节)
+    uint16_t used = 0;  // 当前申请到的空间中已写入的字节数
+
+    if (count == 0)
+        return;
+
+    TFT_Set_Address(htft, x, y, x + (uint16_t)count * font->w - 1, y + font->h - 1);
+    TFT_Reset_Buffer(htft);
+
+    for (uint8_t row = 0; row < font->h; row++)
+    {
+        for (uint8_t i = 0; i < count; i++)
+        {
+            const uint8_t *src = glyphs[i] + row * row_bytes;
+            uint8_t byte = 0;
+            uint8_t shift = 0; // 当前字节中剩余未读的位数
+
+            for (uint8_t col = 0; col < font->w; col++)
+            {
+                if (shift == 0)
+                {
+                    byte = *src++;
+                    shift = 8;
+                }
+                shift -= font->bpp;
+
+                if (avail == 0)
+                {
+                    if (used != 0)
+                        TFT_Buffer_Commit(htft, used);
+                    dst = TFT_Buffer_Reserve(htft, &avail);
+                    used = 0;
+                    if (dst == NULL)
+                        return;
                 }
+
+                const uint8_t *pixel = _tft_aa_ramp[(byte >> shift) & mask];
+                *dst++ = pixel[0];
+                *dst++ = pixel[1];
+                avail -= 2;
+                used += 2;
+            }
+        }
+    }
+
+    TFT_Buffer_Commit(htft, used);
+    TFT_Flush_Buffer(htft, 0);
+}
+
+//----------------- 格式化输出 -----------------
+
+/**
+ * @brief 格式化输出的字符接收函数
+ */
+typedef void (*_TFT_Format_Output)(void *context, uint8_t chr);
+
+/**
+ * @brief 按宽度和对齐方式输出一个已转换好的数字
+ * @param out      字符接收函数
+ * @param context  接收函数的上下文
+ * @param digits   数字字符 (逆序存放，个位在前)
+ * @param count    数字字符个数
+ * @param sign     符号字符 (0 表示没有符号)
+ * @param width    最小宽度
+ * @param left     是否左对齐
+ * @param zero     是否用 '0' 补齐 (右对齐时有效)
+ * @retval 输出的字符数
+ */
+static uint16_t _TFT_Format_Number(_TFT_Format_Output out, void *context, const uint8_t *digits, uint8_t count,
+                                   uint8_t sign, uint8_t width, uint8_t left, uint8_t zero)
+{
+    uint8_t length = count + (sign ? 1 : 0);
+    uint8_t pad = width > length ? width - length : 0;
+    uint16_t total = length + pad;
+
+    if (!left && !zero)
+        for (; pad; pad--)
+            out(context, ' ');
+    if (sign)
+        out(context, sign);
+    if (!left)
+        for (; pad; pad--)
+            out(context, '0');
+    while (count)
+        out(context, digits[--count]);
+    for (; pad; pad--)
+        out(context, ' ');
+    return total;
+}
+
+/**
+ * @brief 把无符号整数逆序转换为数字字符
+ * @param value  数值
+ * @param base   进制 (10 或 16)
+ * @param upper  十六进制是否使用大写字母
+ * @param digits 输出缓冲区 (逆序，至少 10 字节)
+ * @param min    最少位数 (不足时补 0，用于小数部分)
+ * @retval 数字字符个数
+ */
+static uint8_t _TFT_Format_Digits(uint32_t value, uint8_t base, uint8_t upper, uint8_t *digits, uint8_t min)
+{
+    const char *table = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    uint8_t count = 0;
+
+    do
+    {
+        digits[count++] = table[value % base];
+        value /= base;
+    } while (value || count < min);
+    return count;
+}
+
+/**
+ * @brief 轻量格式化 (printf 子集)
+ * @param out     字符接收函数，格式化结果逐字符交给它，不经过中间字符串
+ * @param context 接收函数的上下文
+ * @param fmt     格式字符串
+ * @param args    参数表
+ * @retval 输出的字符数
+ * @note  支持 %d %i %u %x %X %c %s %f %k %%，标志 '-' '0' '+'，宽度、精度和长度修饰 'l'。
+ *        宽度最大 255，精度最大 127，更大的值按最大值处理。
+ *        %f 不依赖 newlib 的浮点 printf，精度 0~9 (默认 6)，绝对值不小于 2^32 时输出 "inf"。
+ *        %k 输出十进制定点数: 整数参数表示 数值 x 10^精度，如 %.3k 把 3300 显示为 3.300。
+ */
+static uint16_t _TFT_Format(_TFT_Format_Output out, void *context, const char *fmt, va_list args)
+{
+    static const uint32_t pow10[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+    uint8_t digits[24]; // 单个数字的转换结果 (逆序)
+    uint16_t total = 0;
+
+    while (*fmt)
+    {
+        uint8_t left = 0, zero = 0, plus = 0, is_long = 0;
+        uint8_t width = 0;
+        int8_t precision = -1;
+        uint8_t count = 0;
+        uint8_t sign = 0;
+
+        if (*fmt != '%')
+        {
+            out(context, (uint8_t)*fmt++);
+            total++;
+            continue;
+        }
+        fmt++;
+
+        // 标志
+        for (;; fmt++)
+        {
+            if (*fmt == '-')
+                left = 1;
+            else if (*fmt == '0')
+                zero = 1;
+            else if (*fmt == '+')
+                plus = 1;
+            else
+                break;
+        }
+        // 宽度和精度 (超出范围时取最大值 255 / 127，不会回绕)
+        while (*fmt >= '0' && *fmt <= '9')
+        {
+            uint16_t value = width * 10 + (*fmt++ - '0');
+            width = value > 255 ? 255 : (uint8_t)value;
+        }
+        if (*fmt == '.')
+        {
+            precision = 0;
+            fmt++;
+            while (*fmt >= '0' && *fmt <= '9')
+            {
+                int16_t value = precision * 10 + (*fmt++ - '0');
+                precision = value > 127 ? 127 : (int8_t)value;
+            }
+        }
+        // 长度修饰
+        while (*fmt == 'l' || *fmt == 'h')
+        {
+            if (*fmt == 'l')
+                is_long = 1;
+            fmt++;
+        }
+
+        switch (*fmt)
+        {
+        case 'd':
+        case 'i':
+        case 'k':
+        {
+            int32_t value = is_long ? (int32_t)va_arg(args, long) : (int32_t)va_arg(args, int);
+            uint32_t magnitude = value < 0 ? (uint32_t)(-(value + 1)) + 1 : (uint32_t)value;
+
+            sign = value < 0 ? '-' : (plus ? '+' : 0);
+            if (*fmt == 'k' && precision > 0)
+            {
+                // 定点数: 小数部分固定 precision 位
+                if (precision > 9)
+                    precision = 9;
+                count = _TFT_Format_Digits(magnitude % pow10[precision], 10, 0, digits, precision);
+                digits[count++] = '.';
+                count += _TFT_Format_Digits(magnitude / pow10[precision], 10, 0, digits + count, 1);
+            }
+            else
+            {
+                count = _TFT_Format_Digits(magnitude, 10, 0, digits, 1);
+            }
+            total += _TFT_Format_Number(out, context, digits, count, sign, width, left, zero);
+            break;
+        }
+        case 'u':
+        case 'x':
+        case 'X':
+        {
+            uint32_t value = is_long ? (uint32_t)va_arg(args, unsigned long) : (uint32_t)va_arg(args, unsigned int);
+
+            count = _TFT_Format_Digits(value, *fmt == 'u' ? 10 : 16, *fmt == 'X', digits, 1);
+            total += _TFT_Format_Number(out, context, digits, count, 0, width, left, zero);
+            break;
+        }
+        case 'f':
+        {
+            double value = va_arg(args, double);
+
+            if (precision < 0)
+                precision = 6;
+            if (precision > 9)
+                precision = 9;
+            if (value < 0)
+            {
+                sign = '-';
+                value = -value;
+            }
+            else if (plus)
+            {
+                sign = '+';
+            }
+
+            if (value != value || value >= 4294967295.0)
+            {
+                // NaN 或超出范围
+                const char *text = (value != value) ? "nan" : "fni"; // 逆序
+                count = 3;
+                memcpy(digits, text, 3);
+                total += _TFT_Format_Number(out, context, digits, count, sign, width, left, 0);
+                break;
             }
+
+            uint32_t integer = (uint32_t)value;
+            uint32_t fraction = (uint32_t)((value - integer) * pow10[precision] + 0.5);
+            if (fraction >= pow10[precision])
+            {
+                fraction -= pow10[precision]; // 四舍五入进位到整数部分
+                integer++;
+            }
+            if (precision > 0)
+            {
+                count = _TFT_Format_Digits(fraction, 10, 0, digits, precision);
+                digits[count++] = '.';
+            }
+            count += _TFT_Format_Digits(integer, 10, 0, digits + count, 1);
+            total += _TFT_Format_Number(out, context, digits, count, sign, width, left, zero);
+            break;
+        }
+        case 'c':
+            digits[0] = (uint8_t)va_arg(args, int);
+            total += _TFT_Format_Number(out, context, digits, 1, 0, width, left, 0);
+            break;
+        case 's':
+        {
+            const char *str = va_arg(args, const char *);
+            uint8_t length = 0;
+
+            if (str == NULL)
+                str = "(null)";
+            while (str[length] && (precision < 0 || length < precision))
+                length++;
+            if (!left)
+                for (uint8_t pad = length; pad < width; pad++, total++)
+                    out(context, ' ');
+            for (uint8_t i = 0; i < length; i++)
+                out(context, (uint8_t)str[i]);
+            total += length;
+            if (left)
+                for (uint8_t pad = length; pad < width; pad++, total++)
+                    out(context, ' ');
+            break;
+        }
+        case '%':
+            out(context, '%');
+            total++;
+            break;
+        case '\0':
+            return total; // 格式字符串以 '%' 结尾
+        default:
+            break; // 不支持的转换说明，忽略
         }
+        fmt++;
+    }
+    return total;
+}
+
+/**
+ * @brief TFT_Printf 的输出上下文: 字符直接收集成字模段，不保存字符串
+ */
+typedef struct
+{
+    TFT_HandleTypeDef *htft;
+    const ASCIIFont *font;
+    uint16_t x0;         // 起始列坐标 (换行时回到此处)
+    uint16_t x;          // 下一个字符的列坐标
+    uint16_t y;          // 当前行坐标
+    uint16_t color;      // 字符颜色
+    uint16_t back_color; // 背景颜色
+    uint8_t mode;        // 0: 背景不透明, 1: 背景透明
+    uint8_t count;       // 已收集的字数
+    uint16_t run_x;      // 已收集的字模段的起始列坐标
+    _TFT_Glyph glyphs[TFT_TEXT_RUN_MAX];
+    TFT_Span_Sink sink; // 背景透明时使用
+} _TFT_Printf_Context;
+
+/**
+ * @brief 输出已收集的字模段
+ * @param ctx 输出上下文
+ */
+static void _TFT_Printf_Flush(_TFT_Printf_Context *ctx)
+{
+    if (ctx->count > 0)
+        _TFT_Draw_Glyph_Run(ctx->htft, ctx->run_x, ctx->y, ctx->glyphs, ctx->count, ctx->color, ctx->back_color, 1);
+    ctx->count = 0;
+    ctx->run_x = ctx->x;
+}
+
+/**
+ * @brief TFT_Printf 的字符接收函数
+ * @param context 输出上下文 (_TFT_Printf_Context)
+ * @param chr     字符 ('\n' 换行)
+ */
+static void _TFT_Printf_Output(void *context, uint8_t chr)
+{
+    _TFT_Printf_Context *ctx = (_TFT_Printf_Context *)context;
+
+    if (chr == '\n')
+    {
+        if (ctx->mode == 0)
+            _TFT_Printf_Flush(ctx);
+        ctx->x = ctx->x0;
+        ctx->y += ctx->font->h;
+        ctx->run_x = ctx->x;
+        return;
+    }
+
+    if (ctx->mode != 0)
+    {
+        _TFT_Draw_Glyph_Transparent(&ctx->sink, ctx->x, ctx->y, ctx->font, _TFT_Glyph_Data(ctx->font, chr), 1);
+    }
+    else
+    {
+        ctx->glyphs[ctx->count].font = ctx->font;
+        ctx->glyphs[ctx->count].glyph = _TFT_Glyph_Data(ctx->font, chr);
+        ctx->count++;
     }
-    TFT_Flush_Buffer(htft, 1);
+    ctx->x += ctx->font->w;
+
+    if (ctx->count == TFT_TEXT_RUN_MAX)
+        _TFT_Printf_Flush(ctx);
+}
+
+/**
+ * @brief 文本框格式化的输出上下文
+ */
+typedef struct
+{
+    uint8_t text[TFT_TEXT_FIELD_MAX + 1];
+    uint8_t length;
+} _TFT_Field_Format_Context;
+
+/**
+ * @brief 文本框格式化的字符接收函数 (超出 TFT_TEXT_FIELD_MAX 的字符丢弃)
+ * @param context 输出上下文 (_TFT_Field_Format_Context)
+ * @param chr     字符
+ */
+static void _TFT_Field_Format_Output(void *context, uint8_t chr)
+{
+    _TFT_Field_Format_Context *ctx = (_TFT_Field_Format_Context *)context;
+
+    if (ctx->length < TFT_TEXT_FIELD_MAX)
+        ctx->text[ctx->length++] = chr;
 }
 
 //----------------- 字符/字符串显示函数 -----------------
@@ -71,30 +1251,167 @@ static void _TFT_Draw_Glyph(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, con
  * @param  str        要显示的 ASCII 字符串
  * @param  color      字符颜色
  * @param  back_color 背景颜色
- * @param  size       字体大小 (支持 8, 12, 16)
+ * @param  size       字体大小 (支持 8, 12, 16, 24)
  * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
  */
 void TFT_Show_String(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, uint16_t color, uint16_t back_color, uint8_t size, uint8_t mode)
 {
+    TFT_Show_String_Scaled(htft, x, y, str, color, back_color, size, 1, mode);
+}
+
+/**
+ * @brief  在指定位置按整数倍放大显示 ASCII 字符串
+ * @param  htft TFT句柄指针
+ * @param  x          起始列坐标
+ * @param  y          起始行坐标
+ * @param  str        要显示的 ASCII 字符串
+ * @param  color      字符颜色
+ * @param  back_color 背景颜色
+ * @param  size       字体大小 (支持 8, 12, 16, 24)
+ * @param  scale      放大倍数 (1 为原始大小，0 按 1 处理)
+ * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+ * @note   背景不透明时字符串按 TFT_TEXT_RUN_MAX 个字符一段，每段只设置一次地址窗口；
+ *         背景透明时只写入前景像素，每行连续的点亮像素作为一次窗口写入。
+ *         放大在输出像素时完成，不需要额外的大字库。
+ */
+void TFT_Show_String_Scaled(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, uint16_t color, uint16_t back_color, uint8_t size, uint8_t scale, uint8_t mode)
+{
+    const ASCIIFont *ascii_font = _TFT_Select_Font(size);
     uint16_t current_x = x;
-    uint8_t char_width = 0;
+    uint16_t advance;
+
+    if (str == NULL)
+        return;
+    if (scale == 0)
+        scale = 1;
+    advance = (uint16_t)ascii_font->w * scale;
+
+    if (mode != 0)
+    {
+        TFT_Span_Sink sink;
+
+        TFT_Span_Begin(&sink, htft, color);
+        while (*str) // 遍历字符串直到遇到 null 终止符
+        {
+            _TFT_Draw_Glyph_Transparent(&sink, current_x, y, ascii_font, _TFT_Glyph_Data(ascii_font, *str), scale);
+            current_x += advance; // 移动到下一个字符的位置
+            str++;                // 指向下一个字符
+        }
+        TFT_Span_End(&sink);
+        return;
+    }
+
+    _TFT_Glyph glyphs[TFT_TEXT_RUN_MAX];
+    uint8_t count = 0;
+
+    while (*str)
+    {
+        glyphs[count].font = ascii_font;
+        glyphs[count].glyph = _TFT_Glyph_Data(ascii_font, *str++);
+        count++;
+
+        // 一段收集满或字符串结束时输出
+        if (count == TFT_TEXT_RUN_MAX || *str == '\0')
+        {
+            _TFT_Draw_Glyph_Run(htft, current_x, y, glyphs, count, color, back_color, scale);
+            current_x += count * advance;
+            count = 0;
+        }
+    }
+}
+
+/**
+ * @brief  初始化文本框
+ * @param  field      文本框
+ * @param  x          起始列坐标
+ * @param  y          起始行坐标
+ * @param  size       字体大小 (支持 8, 12, 16, 24)
+ * @param  color      字符颜色
+ * @param  back_color 背景颜色
+ */
+void TFT_TextField_Init(TFT_TextField *field, uint16_t x, uint16_t y, uint8_t size, uint16_t color, uint16_t back_color)
+{
+    if (field == NULL)
+        return;
+
+    field->x = x;
+    field->y = y;
+    field->size = size;
+    field->color = color;
+    field->back_color = back_color;
+    field->length = 0;
+    field->text[0] = '\0';
+}
+
+/**
+ * @brief  更新文本框内容
+ * @param  htft  TFT句柄指针
+ * @param  field 文本框
+ * @param  str   新的 ASCII 字符串 (超过 TFT_TEXT_FIELD_MAX 的部分不显示)
+ * @note   与上次内容逐字比较，连续变化的字符作为一段文字一次窗口写入，相同的字符不重绘；
+ *         新内容比上次短时用一次填充清除多出的字符格。
+ */
+void TFT_TextField_Update(TFT_HandleTypeDef *htft, TFT_TextField *field, const uint8_t *str)
+{
+    const ASCIIFont *ascii_font;
+    _TFT_Glyph glyphs[TFT_TEXT_RUN_MAX];
+    uint8_t length = 0;
+    uint8_t i = 0;
 
-    while (*str) // 遍历字符串直到遇到 null 终止符
+    if (field == NULL || str == NULL)
+        return;
+
+    ascii_font = _TFT_Select_Font(field->size);
+    while (length < TFT_TEXT_FIELD_MAX && str[length])
+        length++;
+
+    while (i < length)
     {
-        // 调用 TFT_Show_Char 显示当前 ASCII 字符
-        TFT_Show_Char(htft, current_x, y, *str, color, back_color, size, mode);
+        uint8_t start;
+
+        if (i < field->length && field->text[i] == str[i])
+        {
+            i++; // 未变化
+            continue;
+        }
 
-        // 根据字体大小更新 X 坐标
-        if (size == 16)
-            char_width = afont16x8.w;
-        else if (size == 12)
-            char_width = afont12x6.w;
-        else // 默认或 size=8
-            char_width = afont8x6.w;
+        // 收集一段连续变化的字符
+        start = i;
+        while (i < length && (uint8_t)(i - start) < TFT_TEXT_RUN_MAX &&
+               (i >= field->length || field->text[i] != str[i]))
+        {
+            glyphs[i - start].font = ascii_font;
+            glyphs[i - start].glyph = _TFT_Glyph_Data(ascii_font, str[i]);
+            i++;
+        }
+        _TFT_Draw_Glyph_Run(htft, field->x + (uint16_t)start * ascii_font->w, field->y, glyphs, i - start,
+                            field->color, field->back_color, 1);
+    }
 
-        current_x += char_width; // 移动到下一个字符的位置
-        str++;                   // 指向下一个字符
+    // 新内容更短: 清除多出的字符格
+    if (length < field->length)
+    {
+        TFT_Fill_Area(htft, field->x + (uint16_t)length * ascii_font->w, field->y,
+                      field->x + (uint16_t)field->length * ascii_font->w, field->y + ascii_font->h,
+                      field->back_color);
     }
+
+    memcpy(field->text, str, length);
+    field->text[length] = '\0';
+    field->length = length;
+}
+
+/**
+ * @brief  使文本框下次更新时完整重绘
+ * @param  field 文本框
+ */
+void TFT_TextField_Invalidate(TFT_TextField *field)
+{
+    if (field == NULL)
+        return;
+
+    field->length = 0;
+    field->text[0] = '\0';
 }
 
 /**
@@ -105,47 +1422,297 @@ void TFT_Show_String(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint
  * @param  chr        要显示的 ASCII 字符
  * @param  color      字符颜色
  * @param  back_color 背景颜色
- * @param  size       字体大小 (支持 8, 12, 16)
+ * @param  size       字体大小 (支持 8, 12, 16, 24)
  * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
  */
 void TFT_Show_Char(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint8_t chr, uint16_t color, uint16_t back_color, uint8_t size, uint8_t mode)
 {
-    const ASCIIFont *ascii_font;
-    const unsigned char *glyph_data;
-    uint8_t char_width, char_height;
-    uint16_t char_index;
-    uint16_t bytes_per_char;
+    const ASCIIFont *ascii_font = _TFT_Select_Font(size);
+    _TFT_Glyph glyph = {ascii_font, _TFT_Glyph_Data(ascii_font, chr)};
 
-    // 根据字体大小选择对应字库
-    if (size == 16)
+    if (mode == 0)
+        _TFT_Draw_Glyph_Run(htft, x, y, &glyph, 1, color, back_color, 1);
+    else
     {
-        ascii_font = &afont16x8;
-        bytes_per_char = 16; // 8列×16行，每列2字节，共16字节
+        TFT_Span_Sink sink;
+
+        TFT_Span_Begin(&sink, htft, color);
+        _TFT_Draw_Glyph_Transparent(&sink, x, y, ascii_font, glyph.glyph, 1);
+        TFT_Span_End(&sink);
     }
-    else if (size == 12)
+}
+
+/**
+ * @brief  在指定位置显示 UTF-8 字符串 (支持中文)
+ * @param  htft TFT句柄指针
+ * @param  x          起始列坐标
+ * @param  y          起始行坐标
+ * @param  str        要显示的 UTF-8 字符串
+ * @param  font       字库指针 (如 &font16x16)
+ * @param  color      字符颜色
+ * @param  back_color 背景颜色
+ * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+ * @note   字库中找不到的 ASCII 字符使用 font->ascii 显示 (其字高须与字库相同)，其他找不到的字符跳过。
+ *         中英文混排的一段文字与 TFT_Show_String 一样只设置一次地址窗口。
+ */
+void TFT_Show_UTF8(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, const Font *font, uint16_t color, uint16_t back_color, uint8_t mode)
+{
+    // 字库字模按列行式取模，借用 ASCIIFont 描述其尺寸和排列方式
+    const ASCIIFont wide_font = {font->h, font->w, NULL, FONT_LAYOUT_PAGE};
+    const ASCIIFont *ascii_font = font->ascii;
+    _TFT_Glyph glyphs[TFT_TEXT_RUN_MAX];
+    uint8_t count = 0;
+    uint16_t run_x = x, current_x = x;
+    TFT_Span_Sink sink;
+
+    if (str == NULL || font == NULL)
+        return;
+    if (ascii_font != NULL && ascii_font->h != font->h)
+        ascii_font = NULL; // 字高不同无法拼入同一窗口
+
+    if (mode != 0)
+        TFT_Span_Begin(&sink, htft, color);
+
+    while (*str)
     {
-        ascii_font = &afont12x6;
-        bytes_per_char = 12; // 6列×12行，每列2字节，共12字节
+        uint32_t key;
+        _TFT_Glyph glyph;
+
+        str += _TFT_UTF8_Decode(str, &key);
+        glyph.font = &wide_font;
+        glyph.glyph = key ? _TFT_Font_Find(font, key) : NULL;
+        if (glyph.glyph == NULL)
+        {
+            if (ascii_font == NULL || key == 0 || (key >> 24) >= 0x80)
+                continue; // 字库中没有该字符
+            glyph.font = ascii_font;
+            glyph.glyph = _TFT_Glyph_Data(ascii_font, (uint8_t)(key >> 24));
+        }
+
+        if (mode != 0)
+        {
+            _TFT_Draw_Glyph_Transparent(&sink, current_x, y, glyph.font, glyph.glyph, 1);
+        }
+        else
+        {
+            glyphs[count++] = glyph;
+            if (count == TFT_TEXT_RUN_MAX)
+            {
+                _TFT_Draw_Glyph_Run(htft, run_x, y, glyphs, count, color, back_color, 1);
+                run_x = current_x + glyph.font->w;
+                count = 0;
+            }
+        }
+        current_x += glyph.font->w;
     }
+
+    if (mode != 0)
+        TFT_Span_End(&sink);
     else
+        _TFT_Draw_Glyph_Run(htft, run_x, y, glyphs, count, color, back_color, 1);
+}
+
+/**
+ * @brief  计算比例字体字符串的显示宽度
+ * @param  str  ASCII 字符串
+ * @param  font 比例字体
+ * @retval 宽度 (像素，含字距调整)
+ */
+uint16_t TFT_Prop_String_Width(const uint8_t *str, const PropFont *font)
+{
+    int16_t width = 0;
+    uint8_t prev = 0;
+
+    if (str == NULL || font == NULL)
+        return 0;
+
+    for (; *str; str++)
     {
-        ascii_font = &afont8x6;
-        size = 8;
-        bytes_per_char = 6; // 6列×8行，每列1字节，共6字节
+        if (prev)
+            width += _TFT_Prop_Kerning(font, prev, *str);
+        width += PROP_GLYPH_ADVANCE(_TFT_Prop_Glyph(font, *str));
+        prev = *str;
     }
+    return width > 0 ? (uint16_t)width : 0;
+}
+
+/**
+ * @brief  在指定位置用比例字体显示 ASCII 字符串
+ * @param  htft TFT句柄指针
+ * @param  x          起始列坐标
+ * @param  y          起始行坐标 (行顶部)
+ * @param  str        要显示的 ASCII 字符串
+ * @param  font       比例字体 (如 &pfont16)
+ * @param  color      字符颜色
+ * @param  back_color 背景颜色
+ * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+ * @retval 无
+ * @note   每个字按自身步进宽度排列并应用字距调整表。字模在输出时直接解码，
+ *         背景不透明时每 TFT_TEXT_RUN_MAX 个字只设置一次地址窗口。
+ */
+void TFT_Show_Prop_String(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, const PropFont *font, uint16_t color, uint16_t back_color, uint8_t mode)
+{
+    _TFT_Prop_Item items[TFT_TEXT_RUN_MAX];
+    TFT_Span_Sink sink;
+    uint8_t count = 0;
+    uint8_t prev = 0;
+    int16_t pen = 0;   // 笔位置 (相对本段窗口左边)
+    int16_t right = 0; // 本段最右像素 (相对窗口左边，不含)
 
-    char_width = ascii_font->w;
-    char_height = ascii_font->h;
+    if (str == NULL || font == NULL)
+        return;
 
-    // 检查字符是否在可显示范围内
-    if (chr < ' ' || chr > '~')
+    if (mode != 0)
+        TFT_Span_Begin(&sink, htft, color);
+
+    while (*str)
     {
-        chr = ' '; // 不可显示字符显示为空格
+        const PropGlyph *glyph = _TFT_Prop_Glyph(font, *str);
+        int16_t glyph_right;
+
+        prev = *str++;
+
+        items[count].glyph = glyph;
+        items[count].left = pen + PROP_GLYPH_X_OFFSET(glyph);
+        count++;
+
+        pen += PROP_GLYPH_ADVANCE(glyph);
+        glyph_right = items[count - 1].left + PROP_GLYPH_WIDTH(glyph);
+        if (pen > right)
+            right = pen;
+        if (glyph_right > right)
+            right = glyph_right;
+
+        // 与下一个字的字距调整在分段之前计入，跨段的字距对同样生效
+        if (*str)
+            pen += _TFT_Prop_Kerning(font, prev, *str);
+
+        // 一段收集满或字符串结束时输出，下一段窗口从计入字距调整后的笔位置开始
+        if (count == TFT_TEXT_RUN_MAX || *str == '\0')
+        {
+            _TFT_Draw_Prop_Run(htft, x, y, font, items, count, (uint16_t)right,
+                               color, back_color, mode != 0 ? &sink : NULL);
+            x += pen;
+            pen = 0;
+            right = 0;
+            count = 0;
+        }
+    }
+
+    if (mode != 0)
+        TFT_Span_End(&sink);
+}
+
+/**
+ * @brief  在指定位置用抗锯齿字体显示 ASCII 字符串
+ * @param  htft TFT句柄指针
+ * @param  x          起始列坐标
+ * @param  y          起始行坐标
+ * @param  str        要显示的 ASCII 字符串 (超出字体范围的字符显示为第一个字符)
+ * @param  font       抗锯齿字体 (如 &aafont24x12)
+ * @param  color      字符颜色
+ * @param  back_color 背景颜色 (边缘像素按该颜色预先混合，只能显示在纯色背景上)
+ * @retval 无
+ * @note   按 (前景色, 背景色) 预先计算 4 或 16 级色阶表，每像素只需一次查表，没有逐像素混合运算。
+ *         每 TFT_TEXT_RUN_MAX 个字只设置一次地址窗口。
+ */
+void TFT_Show_AA_String(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, const uint8_t *str, const AAFont *font, uint16_t color, uint16_t back_color)
+{
+    const uint8_t *glyphs[TFT_TEXT_RUN_MAX];
+    uint16_t glyph_bytes;
+    uint8_t count = 0;
+
+    if (str == NULL || font == NULL || (font->bpp != 2 && font->bpp != 4))
+        return;
+
+    glyph_bytes = (uint16_t)font->h * (((uint16_t)font->w * font->bpp + 7) / 8);
+    _TFT_AA_Build_Ramp(color, back_color, font->bpp);
+
+    while (*str)
+    {
+        uint8_t chr = *str++;
+
+        if (chr < font->first || chr > font->last)
+            chr = font->first;
+        glyphs[count++] = font->data + (chr - font->first) * glyph_bytes;
+
+        // 一段收集满或字符串结束时输出
+        if (count == TFT_TEXT_RUN_MAX || *str == '\0')
+        {
+            _TFT_Draw_AA_Run(htft, x, y, font, glyphs, count);
+            x += (uint16_t)count * font->w;
+            count = 0;
+        }
     }
+}
+
+/**
+ * @brief  在指定位置格式化显示 ASCII 字符串 (printf 风格)
+ * @param  htft TFT句柄指针
+ * @param  x          起始列坐标
+ * @param  y          起始行坐标
+ * @param  color      字符颜色
+ * @param  back_color 背景颜色
+ * @param  size       字体大小 (支持 8, 12, 16, 24)
+ * @param  mode       模式 (0: 背景不透明, 1: 背景透明)
+ * @param  fmt        格式字符串 (支持的转换说明见 _TFT_Format，'\n' 换到下一行的起始列)
+ * @retval 输出的字符数
+ * @note   格式化结果逐字符直接收集成字模段输出，不经过中间字符串，也不需要 newlib 的浮点 printf。
+ */
+uint16_t TFT_Printf(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint16_t color, uint16_t back_color, uint8_t size, uint8_t mode, const char *fmt, ...)
+{
+    _TFT_Printf_Context ctx;
+    va_list args;
+    uint16_t total;
+
+    if (htft == NULL || fmt == NULL)
+        return 0;
+
+    ctx.htft = htft;
+    ctx.font = _TFT_Select_Font(size);
+    ctx.x0 = x;
+    ctx.x = x;
+    ctx.y = y;
+    ctx.color = color;
+    ctx.back_color = back_color;
+    ctx.mode = mode;
+    ctx.count = 0;
+    ctx.run_x = x;
+    if (mode != 0)
+        TFT_Span_Begin(&ctx.sink, htft, color);
+
+    va_start(args, fmt);
+    total = _TFT_Format(_TFT_Printf_Output, &ctx, fmt, args);
+    va_end(args);
+
+    if (mode != 0)
+        TFT_Span_End(&ctx.sink);
+    else
+        _TFT_Printf_Flush(&ctx);
+    return total;
+}
+
+/**
+ * @brief  格式化更新文本框内容 (printf 风格)
+ * @param  htft  TFT句柄指针
+ * @param  field 文本框
+ * @param  fmt   格式字符串 (同 TFT_Printf)
+ * @retval 无
+ * @note   格式化结果超过 TFT_TEXT_FIELD_MAX 的部分丢弃，然后按 TFT_TextField_Update 只重绘变化的字符。
+ */
+void TFT_TextField_Printf(TFT_HandleTypeDef *htft, TFT_TextField *field, const char *fmt, ...)
+{
+    _TFT_Field_Format_Context ctx;
+    va_list args;
+
+    if (field == NULL || fmt == NULL)
+        return;
 
-    char_index = chr - ' ';                                       // 计算字符在字库中的索引位置
-    glyph_data = ascii_font->chars + char_index * bytes_per_char; // 指向对应字模数据
+    ctx.length = 0;
+    va_start(args, fmt);
+    _TFT_Format(_TFT_Field_Format_Output, &ctx, fmt, args);
+    va_end(args);
+    ctx.text[ctx.length] = '\0';
 
-    // 调用绘制函数
-    _TFT_Draw_Glyph(htft, x, y, glyph_data, char_width, char_height, color, back_color, mode);
+    TFT_TextField_Update(htft, field, ctx.text);
 }
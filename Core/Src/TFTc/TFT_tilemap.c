@@ -0,0 +1,185 @@
+/*
+ * @file    TFT_tilemap.c
+ * @brief   TFT屏幕图块地图 (Tile Map) 背景
+ */
+#include "TFTh/TFT_tilemap.h"
+#include "TFTh/TFT_io.h"
+#include <string.h> // 用于 memset
+
+//----------------- 图块地图函数 -----------------
+
+/**
+ * @brief  初始化图块地图 (滚动偏移为 0)
+ * @param  map       图块地图
+ * @param  tiles     图块数据
+ * @param  tile_size 图块边长 (8 或 16)
+ * @param  palette   16 色调色板
+ * @param  cells     地图 (columns x rows 字节)
+ * @param  columns   地图列数
+ * @param  rows      地图行数
+ * @retval 无
+ */
+void TFT_Tilemap_Init(TFT_Tilemap *map, const uint8_t *tiles, uint8_t tile_size, const uint16_t *palette,
+                      uint8_t *cells, uint16_t columns, uint16_t rows)
+{
+    if (map == NULL)
+        return;
+
+    map->tiles = tiles;
+    map->palette = palette;
+    map->cells = cells;
+    map->columns = columns;
+    map->rows = rows;
+    map->tile_size = tile_size == 16 ? 16 : 8;
+    map->scroll_x = 0;
+    map->scroll_y = 0;
+}
+
+/**
+ * @brief  设置滚动偏移
+ * @param  map      图块地图
+ * @param  scroll_x 水平偏移 (像素)
+ * @param  scroll_y 垂直偏移 (像素)
+ * @retval 无
+ */
+void TFT_Tilemap_Scroll(TFT_Tilemap *map, uint16_t scroll_x, uint16_t scroll_y)
+{
+    if (map == NULL)
+        return;
+
+    map->scroll_x = scroll_x;
+    map->scroll_y = scroll_y;
+}
+
+/**
+ * @brief  图块地图背景函数: 生成屏幕一行中一段像素
+ * @param  context TFT_Tilemap 指针
+ * @param  x       起始列坐标
+ * @param  y       行坐标
+ * @param  width   像素数
+ * @param  pixels  输出 RGB565 像素 (高字节在前)
+ * @retval 无
+ * @note   每个图块行先定位一次图块数据，段内逐字节取出两个调色板序号查表输出。
+ *         地图为空 (0 列或 0 行) 或数据指针为 NULL 时输出黑色。
+ */
+void TFT_Tilemap_Background(void *context, int16_t x, int16_t y, uint16_t width, uint8_t *pixels)
+{
+    const TFT_Tilemap *map = (const TFT_Tilemap *)context;
+
+    if (map == NULL || map->tiles == NULL || map->palette == NULL || map->cells == NULL ||
+        map->columns == 0 || map->rows == 0)
+    {
+        memset(pixels, 0, (uint32_t)width * 2); // 下面的取模需要非零的地图尺寸
+        return;
+    }
+
+    uint8_t shift = map->tile_size == 16 ? 4 : 3;          // 图块边长的 log2
+    uint8_t mask = map->tile_size - 1;                     // 图块内坐标掩码
+    uint16_t row_bytes = map->tile_size / 2;               // 图块一行的字节数
+    uint32_t map_width = (uint32_t)map->columns << shift;  // 地图宽度 (像素)
+    uint32_t map_height = (uint32_t)map->rows << shift;    // 地图高度 (像素)
+    // 调用者已与剪裁矩形求交，x、y 不会为负数
+    uint32_t my = ((uint32_t)(uint16_t)y + map->scroll_y) % map_height;
+    uint32_t mx = ((uint32_t)(uint16_t)x + map->scroll_x) % map_width;
+    const uint8_t *cells = map->cells + (my >> shift) * map->columns; // 当前地图行
+    uint32_t tile_offset = (my & mask) * row_bytes;                    // 图块内当前行的偏移
+
+    while (width > 0)
+    {
+        uint16_t column = mx >> shift;
+        uint8_t tx = mx & mask;
+        uint16_t count = map->tile_size - tx; // 本图块内的像素数
+        const uint8_t *src = map->tiles + (uint32_t)cells[column] * row_bytes * map->tile_size + tile_offset + tx / 2;
+
+        if (count > width)
+            count = width;
+        width -= count;
+        mx += count;
+        if (mx >= map_width)
+            mx = 0;
+
+        // 起点在字节的低 4 位 (奇数列) 时先输出一个像素
+        if (tx & 1)
+        {
+            uint16_t color = map->palette[*src++ & 0x0F];
+            *pixels++ = color >> 8;
+            *pixels++ = color & 0xFF;
+            count--;
+        }
+        for (; count >= 2; count -= 2)
+        {
+            uint8_t pair = *src++;
+            uint16_t left = map->palette[pair >> 4];
+            uint16_t right = map->palette[pair & 0x0F];
+
+            pixels[0] = left >> 8;
+            pixels[1] = left & 0xFF;
+            pixels[2] = right >> 8;
+            pixels[3] = right & 0xFF;
+            pixels += 4;
+        }
+        if (count)
+        {
+            uint16_t color = map->palette[*src >> 4];
+            *pixels++ = color >> 8;
+            *pixels++ = color & 0xFF;
+        }
+    }
+}
+
+/**
+ * @brief  绘制图块地图的一个屏幕区域
+ * @param  htft   TFT句柄指针
+ * @param  map    图块地图
+ * @param  x      区域左上角列坐标
+ * @param  y      区域左上角行坐标
+ * @param  width  区域宽度
+ * @param  height 区域高度
+ * @retval 无
+ */
+void TFT_Draw_Tilemap(TFT_HandleTypeDef *htft, const TFT_Tilemap *map, int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+    int32_t x0 = x, y0 = y, x1 = (int32_t)x + width, y1 = (int32_t)y + height;
+
+    if (htft == NULL || map == NULL || map->tiles == NULL || map->palette == NULL || map->cells == NULL ||
+        map->columns == 0 || map->rows == 0)
+        return;
+
+    // 与剪裁矩形求交
+    if (x0 < htft->clip_x0)
+        x0 = htft->clip_x0;
+    if (y0 < htft->clip_y0)
+        y0 = htft->clip_y0;
+    if (x1 > htft->clip_x1)
+        x1 = htft->clip_x1;
+    if (y1 > htft->clip_y1)
+        y1 = htft->clip_y1;
+    if (x0 >= x1 || y0 >= y1)
+        return;
+
+    TFT_Set_Address(htft, x0, y0, x1 - 1, y1 - 1);
+    TFT_Reset_Buffer(htft);
+
+    for (int32_t row = y0; row < y1; row++)
+    {
+        int32_t column = x0;
+
+        while (column < x1)
+        {
+            uint16_t avail;
+            uint8_t *dst = TFT_Buffer_Reserve(htft, &avail);
+            uint16_t count = avail / 2;
+
+            if (dst == NULL)
+                return;
+            if (count > x1 - column)
+                count = x1 - column;
+
+            TFT_Tilemap_Background((void *)map, column, row, count, dst);
+            TFT_Buffer_Commit(htft, count * 2);
+            column += count;
+        }
+    }
+
+    TFT_Flush_Buffer(htft, 0); // 最后一块数据不等待发送完成
+}
@@ -109,7 +109,7 @@ const unsigned char ascii_8x6[][6] = {
     {0x14, 0x14, 0x14, 0x14, 0x14, 0x14}, // horiz lines
 };
 
-const ASCIIFont afont8x6 = {8, 6, (unsigned char *)ascii_8x6};
+const ASCIIFont afont8x6 = {8, 6, (unsigned char *)ascii_8x6, FONT_LAYOUT_PAGE};
 
 const unsigned char ascii_12x6[][12] = {
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*" ",0*/
@@ -209,7 +209,7 @@ const unsigned char ascii_12x6[][12] = {
     {0x02, 0x01, 0x02, 0x04, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*"~",94*/
 };
 
-const ASCIIFont afont12x6 = {12, 6, (unsigned char *)ascii_12x6};
+const ASCIIFont afont12x6 = {12, 6, (unsigned char *)ascii_12x6, FONT_LAYOUT_PAGE};
 
 const unsigned char ascii_16x8[][16] = {
 {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*" ",0*/
@@ -309,7 +309,7 @@ const unsigned char ascii_16x8[][16] = {
 {0x0C,0x32,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00},/*"~",94*/
 };
 
-const ASCIIFont afont16x8 = {16, 8, (unsigned char *)ascii_16x8};
+const ASCIIFont afont16x8 = {16, 8, (unsigned char *)ascii_16x8, FONT_LAYOUT_ROW};
 
 const unsigned char ascii_24x12[][36] = {
     {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, /*" ",0*/
@@ -410,7 +410,7 @@ const unsigned char ascii_24x12[][36] = {
     /*"~",94*/                                                                                                                                                                                                                /*"~",94*/
 };
 
-const ASCIIFont afont24x12 = {24, 12, (unsigned char *)ascii_24x12};
+const ASCIIFont afont24x12 = {24, 12, (unsigned char *)ascii_24x12, FONT_LAYOUT_PAGE};
 
 const uint8_t zh16x16[][36] = {
 /* 0 Ω */ {0xce,0xa9,0x00,0x00,0x00,0x00,0x00,0xe0,0x18,0x0c,0x04,0x02,0x02,0x02,0x04,0x0c,0x18,0xe0,0x00,0x00,0x00,0x00,0x00,0x38,0x23,0x26,0x24,0x38,0x00,0x38,0x24,0x26,0x23,0x38,0x00,0x00,},
@@ -432,7 +432,220 @@ const uint8_t zh16x16[][36] = {
 /* 16 峰 */ {0xe5,0xb3,0xb0,0x00,0x00,0xf0,0x00,0xff,0x00,0xf0,0x80,0x90,0x4c,0x57,0xa4,0x54,0x4c,0x84,0x80,0x00,0x00,0x1f,0x10,0x0f,0x08,0x1f,0x10,0x10,0x15,0x15,0xff,0x15,0x15,0x10,0x10,0x00,},
 /* 17 值 */ {0xe5,0x80,0xbc,0x00,0x00,0x80,0x60,0xf8,0x07,0x04,0xe4,0xa4,0xa4,0xbf,0xa4,0xa4,0xe4,0x04,0x00,0x00,0x01,0x00,0x00,0xff,0x40,0x40,0x7f,0x4a,0x4a,0x4a,0x4a,0x4a,0x7f,0x40,0x40,0x00,}
 };
-const Font font16x16 = {16, 16, (const uint8_t *)zh16x16, 18, &afont16x8};
+// zh16x16 的字序号按utf8编码排序: Ω 中 交 信 值 入 压 号 大 小 峰 效 无 有 流 电 输 阻
+const uint8_t zh16x16_index[] = {0, 7, 5, 10, 17, 13, 2, 11, 8, 6, 16, 15, 9, 14, 3, 1, 12, 4};
+const Font font16x16 = {16, 16, (const uint8_t *)zh16x16, 18, &afont16x8, zh16x16_index};
+
+// 16 像素高比例字体，由 Tools/gen_prop_font.py 从 ascii_16x8 生成
+const uint8_t prop16_bitmap[] = {
+    0xFD,0xE8,0x24,0x9B,0x24,0x01,0xA4,0xFD,0x49,0xF6,0x27,0x19,0x84,0x53,0x2B,0x0C,
+    0x86,0x56,0x73,0x48,0x22,0x25,0x95,0xA9,0x60,0x51,0x27,0x02,0x0C,0x24,0xA6,0xC0,
+    0x4E,0x89,0x14,0x11,0x22,0xB9,0x01,0x8E,0x06,0x88,0x48,0xF1,0x49,0x04,0x01,0x41,
+    0x50,0xF8,0x51,0x22,0x00,0x88,0xD6,0x38,0xAD,0x21,0x02,0x88,0xFB,0x43,0x1C,0x8E,
+    0x06,0x7F,0x07,0x40,0xA0,0x20,0x21,0x22,0x24,0x28,0x10,0x0C,0x49,0xF8,0x93,0x30,
+    0xC4,0x41,0xFE,0x3E,0x9E,0x70,0x50,0x08,0x82,0x20,0xF4,0x03,0x9E,0x30,0x08,0x03,
+    0x02,0x16,0x8A,0x38,0x10,0x0C,0x45,0x2A,0xEA,0x07,0xC5,0x03,0xBF,0x60,0x8D,0x09,
+    0x58,0x28,0xE2,0x00,0x1C,0x49,0x50,0x63,0x12,0x4E,0xC2,0x00,0xBF,0x28,0x24,0xE2,
+    0x03,0x9E,0x70,0x12,0x86,0x24,0x9C,0x07,0x0C,0x49,0x38,0x19,0x0B,0x4C,0xE2,0x00,
+    0xC7,0x1D,0xE2,0x59,0x20,0x08,0x82,0x20,0x08,0x08,0x08,0x08,0x08,0x08,0x7F,0x80,
+    0xFD,0x01,0x01,0x01,0x01,0x01,0x01,0x41,0x10,0x04,0x41,0x00,0x9E,0xB0,0x11,0x08,
+    0x82,0x04,0x60,0x02,0x1C,0x22,0x5A,0xD5,0x6B,0x11,0x12,0xE1,0x00,0x08,0x61,0xA0,
+    0x88,0x04,0x0F,0x11,0x42,0x9D,0x03,0x1F,0xA2,0x79,0x88,0x08,0x27,0xF2,0x01,0x7C,
+    0xC2,0x02,0x4F,0x48,0x84,0x03,0x1F,0x22,0xC2,0x9F,0xC8,0x07,0x3F,0x42,0x92,0x3C,
+    0x24,0x09,0x08,0xFB,0x01,0x3F,0x42,0x92,0x3C,0x24,0x09,0x76,0x00,0x3C,0xA2,0x02,
+    0x8B,0x0B,0x11,0xC5,0x01,0xE7,0x84,0xCE,0x8F,0xD0,0x9D,0x03,0x1F,0xF9,0xF7,0x01,
+    0x7C,0x90,0xFF,0x22,0x1E,0x77,0x22,0x12,0x0A,0x0E,0x0A,0x92,0x44,0xDD,0x01,0x07,
+    0x82,0x3F,0xA1,0x3F,0x77,0xB6,0x53,0xBD,0x35,0xE3,0x8C,0x52,0x4A,0x6A,0x62,0x1D,
+    0x01,0x1C,0x22,0xC1,0x9F,0x08,0x07,0x3F,0xC2,0xF3,0x11,0xDC,0x01,0x1C,0x22,0xC1,
+    0xD7,0x34,0x25,0xC3,0x01,0x06,0x3F,0x84,0xE6,0x43,0x22,0x91,0x84,0x1C,0x03,0xBE,
+    0xB0,0x80,0x80,0x01,0x01,0x85,0x7D,0x7F,0x49,0x88,0x3F,0x0E,0xE7,0x84,0xFE,0xF1,
+    0x00,0xE7,0x84,0x12,0x41,0x12,0x45,0x18,0x10,0x02,0x6B,0xC9,0xAB,0x66,0x23,0x1A,
+    0xE7,0x84,0x90,0x84,0x31,0x92,0x84,0x9C,0x03,0x77,0xA2,0x28,0x21,0x1E,0x07,0x7E,
+    0x21,0x20,0x90,0x10,0x08,0x09,0xFB,0x01,0x2F,0xFE,0xEF,0x01,0x41,0x42,0xC4,0x90,
+    0xA0,0x81,0x01,0x0F,0xFF,0xEF,0x01,0x4E,0x04,0xFF,0x43,0x1E,0x21,0x3C,0x22,0xA1,
+    0xFC,0x03,0x82,0x69,0x98,0x08,0x67,0xA2,0x01,0x1C,0x51,0x30,0x11,0x07,0x30,0xA0,
+    0xF1,0x88,0x84,0x26,0xC3,0x06,0x9E,0xD0,0x2F,0x28,0xE4,0x01,0x78,0x44,0x84,0x7E,
+    0x08,0xEF,0x03,0xBE,0x28,0x47,0xC0,0x13,0xE6,0x01,0x03,0x04,0xA6,0xC3,0x88,0xD0,
+    0x9D,0x03,0x26,0xD0,0x41,0xDE,0x07,0x38,0x10,0x07,0xBF,0xE8,0x01,0x03,0x82,0xC9,
+    0x49,0x28,0x58,0x48,0x88,0xDC,0x01,0x07,0xF9,0xF7,0x01,0x7F,0x24,0xDF,0x2D,0x3B,
+    0x8C,0x08,0xDD,0x39,0x9E,0xF0,0x79,0x1B,0x26,0xC2,0x89,0x78,0x08,0x1C,0x00,0x3C,
+    0x22,0xA1,0x89,0xF0,0x80,0xC0,0x01,0x77,0x4C,0x84,0xFB,0x00,0xBE,0x50,0xC0,0x03,
+    0x0A,0x7D,0xA4,0x8F,0x3C,0x0C,0x63,0x84,0x4E,0x0C,0x37,0xE7,0x84,0x90,0x44,0x01,
+    0x21,0xEB,0x92,0xAA,0x4A,0x24,0x3B,0x09,0x33,0xC9,0x0D,0xE7,0x84,0x90,0x44,0x01,
+    0x03,0x42,0x07,0xBF,0x08,0x82,0x48,0xF4,0x03,0x4C,0x5E,0x90,0x8F,0x01,0xFF,0xFF,
+    0x83,0x1E,0xA2,0x6F,0x00,0x06,0x19,0x61,
+};
+const PropGlyph prop16_glyphs[] = {
+    PROP_GLYPH(0, 0, 1, 0, 0, 4), /*   */
+    PROP_GLYPH(0, 2, 11, 0, 3, 3), /* ! */
+    PROP_GLYPH(2, 6, 4, 0, 1, 7), /* " */
+    PROP_GLYPH(6, 7, 11, 0, 3, 8), /* # */
+    PROP_GLYPH(12, 5, 14, 0, 2, 6), /* $ */
+    PROP_GLYPH(20, 7, 11, 0, 3, 8), /* % */
+    PROP_GLYPH(28, 8, 11, 0, 3, 9), /* & */
+    PROP_GLYPH(39, 3, 4, 0, 1, 4), /* ' */
+    PROP_GLYPH(41, 4, 14, 0, 1, 5), /* ( */
+    PROP_GLYPH(47, 4, 14, 0, 1, 5), /* ) */
+    PROP_GLYPH(53, 7, 8, 0, 4, 8), /* * */
+    PROP_GLYPH(59, 7, 9, 0, 4, 8), /* + */
+    PROP_GLYPH(63, 3, 4, 0, 12, 4), /* , */
+    PROP_GLYPH(65, 7, 1, 0, 8, 8), /* - */
+    PROP_GLYPH(66, 2, 2, 0, 12, 3), /* . */
+    PROP_GLYPH(67, 7, 13, 0, 2, 8), /* / */
+    PROP_GLYPH(75, 6, 11, 0, 3, 7), /* 0 */
+    PROP_GLYPH(80, 5, 11, 0, 3, 6), /* 1 */
+    PROP_GLYPH(84, 6, 11, 0, 3, 7), /* 2 */
+    PROP_GLYPH(92, 6, 11, 0, 3, 7), /* 3 */
+    PROP_GLYPH(100, 6, 11, 0, 3, 7), /* 4 */
+    PROP_GLYPH(108, 6, 11, 0, 3, 7), /* 5 */
+    PROP_GLYPH(116, 6, 11, 0, 3, 7), /* 6 */
+    PROP_GLYPH(124, 6, 11, 0, 3, 7), /* 7 */
+    PROP_GLYPH(129, 6, 11, 0, 3, 7), /* 8 */
+    PROP_GLYPH(136, 6, 11, 0, 3, 7), /* 9 */
+    PROP_GLYPH(144, 2, 8, 0, 6, 3), /* : */
+    PROP_GLYPH(146, 2, 9, 0, 7, 3), /* ; */
+    PROP_GLYPH(148, 6, 11, 0, 3, 7), /* < */
+    PROP_GLYPH(158, 7, 5, 0, 6, 8), /* = */
+    PROP_GLYPH(162, 6, 11, 0, 3, 7), /* > */
+    PROP_GLYPH(172, 6, 11, 0, 3, 7), /* ? */
+    PROP_GLYPH(180, 7, 11, 0, 3, 8), /* @ */
+    PROP_GLYPH(189, 8, 11, 0, 3, 9), /* A */
+    PROP_GLYPH(199, 7, 11, 0, 3, 8), /* B */
+    PROP_GLYPH(207, 7, 11, 0, 3, 8), /* C */
+    PROP_GLYPH(214, 7, 11, 0, 3, 8), /* D */
+    PROP_GLYPH(220, 7, 11, 0, 3, 8), /* E */
+    PROP_GLYPH(229, 7, 11, 0, 3, 8), /* F */
+    PROP_GLYPH(237, 7, 11, 0, 3, 8), /* G */
+    PROP_GLYPH(245, 8, 11, 0, 3, 9), /* H */
+    PROP_GLYPH(252, 5, 11, 0, 3, 6), /* I */
+    PROP_GLYPH(256, 7, 13, 0, 3, 8), /* J */
+    PROP_GLYPH(261, 7, 11, 0, 3, 8), /* K */
+    PROP_GLYPH(271, 7, 11, 0, 3, 8), /* L */
+    PROP_GLYPH(276, 7, 11, 0, 3, 8), /* M */
+    PROP_GLYPH(281, 8, 11, 0, 3, 9), /* N */
+    PROP_GLYPH(289, 7, 11, 0, 3, 8), /* O */
+    PROP_GLYPH(295, 7, 11, 0, 3, 8), /* P */
+    PROP_GLYPH(301, 7, 12, 0, 3, 8), /* Q */
+    PROP_GLYPH(310, 8, 11, 0, 3, 9), /* R */
+    PROP_GLYPH(319, 6, 11, 0, 3, 7), /* S */
+    PROP_GLYPH(327, 7, 11, 0, 3, 8), /* T */
+    PROP_GLYPH(332, 8, 11, 0, 3, 9), /* U */
+    PROP_GLYPH(337, 8, 11, 0, 3, 9), /* V */
+    PROP_GLYPH(346, 7, 11, 0, 3, 8), /* W */
+    PROP_GLYPH(352, 8, 11, 0, 3, 9), /* X */
+    PROP_GLYPH(361, 7, 11, 0, 3, 8), /* Y */
+    PROP_GLYPH(367, 7, 11, 0, 3, 8), /* Z */
+    PROP_GLYPH(376, 4, 14, 0, 1, 5), /* [ */
+    PROP_GLYPH(380, 6, 14, 0, 2, 7), /* \\ */
+    PROP_GLYPH(387, 4, 14, 0, 1, 5), /* ] */
+    PROP_GLYPH(391, 5, 2, 0, 1, 6), /* ^ */
+    PROP_GLYPH(393, 8, 1, 0, 15, 9), /* _ */
+    PROP_GLYPH(394, 3, 2, 0, 1, 4), /* ` */
+    PROP_GLYPH(395, 7, 7, 0, 7, 8), /* a */
+    PROP_GLYPH(401, 7, 11, 0, 3, 8), /* b */
+    PROP_GLYPH(409, 6, 7, 0, 7, 7), /* c */
+    PROP_GLYPH(414, 7, 11, 0, 3, 8), /* d */
+    PROP_GLYPH(422, 6, 7, 0, 7, 7), /* e */
+    PROP_GLYPH(428, 7, 11, 0, 3, 8), /* f */
+    PROP_GLYPH(435, 6, 9, 0, 7, 7), /* g */
+    PROP_GLYPH(442, 8, 11, 0, 3, 9), /* h */
+    PROP_GLYPH(450, 5, 11, 0, 3, 6), /* i */
+    PROP_GLYPH(455, 5, 13, 0, 3, 6), /* j */
+    PROP_GLYPH(461, 7, 11, 0, 3, 8), /* k */
+    PROP_GLYPH(471, 5, 11, 0, 3, 6), /* l */
+    PROP_GLYPH(475, 8, 7, 0, 7, 9), /* m */
+    PROP_GLYPH(479, 8, 7, 0, 7, 9), /* n */
+    PROP_GLYPH(484, 6, 7, 0, 7, 7), /* o */
+    PROP_GLYPH(487, 7, 9, 0, 7, 8), /* p */
+    PROP_GLYPH(495, 7, 9, 0, 7, 8), /* q */
+    PROP_GLYPH(503, 7, 7, 0, 7, 8), /* r */
+    PROP_GLYPH(508, 6, 7, 0, 7, 7), /* s */
+    PROP_GLYPH(514, 5, 9, 0, 5, 6), /* t */
+    PROP_GLYPH(518, 8, 7, 0, 7, 9), /* u */
+    PROP_GLYPH(523, 8, 7, 0, 7, 9), /* v */
+    PROP_GLYPH(529, 8, 7, 0, 7, 9), /* w */
+    PROP_GLYPH(534, 6, 7, 0, 7, 7), /* x */
+    PROP_GLYPH(539, 8, 9, 0, 7, 9), /* y */
+    PROP_GLYPH(547, 6, 7, 0, 7, 7), /* z */
+    PROP_GLYPH(553, 4, 14, 0, 1, 5), /* { */
+    PROP_GLYPH(558, 1, 16, 0, 0, 2), /* | */
+    PROP_GLYPH(560, 4, 14, 0, 1, 5), /* } */
+    PROP_GLYPH(565, 7, 3, 0, 0, 8), /* ~ */
+};
+const PropKern prop16_kerning[] = {
+    {'A', 'T', -1},
+    {'A', 'V', -1},
+    {'A', 'Y', -1},
+    {'F', ',', -1},
+    {'F', '.', -1},
+    {'F', 'A', -1},
+    {'F', 'a', -1},
+    {'F', 'c', -1},
+    {'F', 'e', -1},
+    {'F', 'o', -1},
+    {'L', 'T', -1},
+    {'L', 'V', -1},
+    {'L', 'Y', -1},
+    {'P', ',', -1},
+    {'P', '.', -1},
+    {'P', 'A', -1},
+    {'P', 'c', -1},
+    {'T', ',', -1},
+    {'T', '.', -1},
+    {'T', 'A', -1},
+    {'T', 'a', -1},
+    {'T', 'c', -1},
+    {'T', 'e', -1},
+    {'T', 'o', -1},
+    {'V', ',', -1},
+    {'V', '.', -1},
+    {'V', 'A', -1},
+    {'V', 'a', -1},
+    {'V', 'c', -1},
+    {'V', 'e', -1},
+    {'V', 'o', -1},
+    {'W', ',', -1},
+    {'Y', ',', -1},
+    {'Y', '.', -1},
+    {'Y', 'A', -1},
+    {'Y', 'a', -1},
+    {'Y', 'c', -1},
+    {'Y', 'e', -1},
+    {'Y', 'o', -1},
+};
+const PropFont pfont16 = {16, 0x20, 0x7E, prop16_glyphs, prop16_bitmap, prop16_kerning, 39};
+
+// 24x12 抗锯齿字体 (2 位灰度)，由 Tools/gen_aa_font.py 从 ascii_24x12 生成
+const uint8_t aa24x12_data[] = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /*   */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x3F,0x00,0x00,0x2E,0x00,0x00,0x1D,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x00,0x3F,0x00,0x00,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* ! */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x28,0x28,0x00,0x78,0x78,0x01,0xA5,0xA4,0x02,0x92,0x90,0x07,0x47,0x40,0x09,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* " */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x30,0x03,0x00,0x30,0x03,0x00,0x30,0x07,0x40,0x74,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x07,0x40,0x74,0x07,0x00,0x70,0x0D,0x00,0xD0,0x1D,0x01,0xD0,0x2F,0xFF,0xF8,0x2F,0xFF,0xF8,0x1D,0x01,0xD0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x0C,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* # */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x1D,0x00,0x01,0xBF,0x90,0x06,0x8C,0xE0,0x0B,0x4C,0xF0,0x0F,0x0C,0xA0,0x0B,0x4C,0x00,0x06,0x8C,0x00,0x01,0xBD,0x00,0x00,0x6E,0x40,0x00,0x1F,0x80,0x00,0x0F,0xD0,0x00,0x0C,0xE0,0x0A,0x0C,0xF0,0x0F,0x0C,0xF0,0x0B,0x0C,0xE0,0x07,0x5C,0xD0,0x01,0xFF,0x40,0x00,0x1D,0x00,0x00,0x0C,0x00,0x00,0x00,0x00, /* $ */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0xB0,0x73,0x40,0xD0,0xD1,0xC1,0xC0,0xC0,0xC3,0x40,0xC0,0xC7,0x00,0xC0,0xCA,0x00,0xD1,0xCC,0x00,0x72,0xFF,0xE0,0x2E,0x37,0x34,0x00,0x69,0x1C,0x00,0xCC,0x0C,0x01,0xCC,0x0C,0x02,0x8C,0x0C,0x03,0x4D,0x1C,0x07,0x07,0x34,0x09,0x02,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* % */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xE4,0x00,0x0D,0x78,0x00,0x0C,0x3C,0x00,0x0C,0x3C,0x00,0x0C,0x39,0x00,0x0D,0x73,0xF0,0x0F,0xD1,0xD0,0x1B,0x00,0xC0,0x32,0x81,0xC0,0x71,0xD3,0x40,0xB0,0xA3,0x00,0xF0,0x7E,0x00,0xF0,0x2C,0x00,0xB4,0x0A,0x00,0x69,0x63,0x58,0x1B,0xD1,0xF4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* & */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x40,0x00,0x0B,0x80,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x07,0x40,0x00,0x3D,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* ' */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x74,0x00,0x01,0xD0,0x00,0x02,0x80,0x00,0x07,0x40,0x00,0x0B,0x00,0x00,0x1E,0x00,0x00,0x2D,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x2D,0x00,0x00,0x1E,0x00,0x00,0x0B,0x00,0x00,0x07,0x40,0x00,0x02,0x80,0x00,0x01,0xD0,0x00,0x00,0x74,0x00,0x00,0x18,0x00,0x00,0x00, /* ( */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x24,0x00,0x00,0x1D,0x00,0x00,0x07,0x40,0x00,0x02,0x80,0x00,0x01,0xD0,0x00,0x00,0xE0,0x00,0x00,0xB4,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xB4,0x00,0x00,0xE0,0x00,0x01,0xD0,0x00,0x02,0x80,0x00,0x07,0x40,0x00,0x1D,0x00,0x00,0x24,0x00,0x00,0x00,0x00,0x00, /* ) */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x3E,0x4C,0x6F,0x1B,0x8C,0xB9,0x01,0xFF,0xD0,0x01,0xFF,0xD0,0x1B,0x8C,0xB9,0x3E,0x4C,0x6F,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* * */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x1D,0x00,0x3F,0xFF,0xFF,0x00,0x1D,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* + */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0A,0x40,0x00,0x0B,0x80,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x07,0x40,0x00,0x3D,0x00,0x00, /* , */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0xFF,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* - */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0x80,0x00,0x0F,0xC0,0x00,0x0B,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* . */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x28,0x00,0x00,0x74,0x00,0x00,0xA0,0x00,0x00,0xD0,0x00,0x01,0xC0,0x00,0x03,0x40,0x00,0x07,0x00,0x00,0x0D,0x00,0x00,0x1C,0x00,0x00,0x28,0x00,0x00,0x34,0x00,0x00,0x70,0x00,0x00,0xD0,0x00,0x01,0xC0,0x00,0x03,0x40,0x00,0x07,0x00,0x00,0x0A,0x00,0x00,0x1D,0x00,0x00,0x28,0x00,0x00,0x34,0x00,0x00,0x00,0x00,0x00, /* / */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xBE,0x40,0x06,0x96,0x90,0x0B,0x41,0xE0,0x1E,0x00,0xB4,0x2D,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x2D,0x00,0x78,0x1E,0x00,0xB4,0x0B,0x41,0xE0,0x06,0x96,0x90,0x01,0xBE,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 0 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x6C,0x00,0x0F,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x7D,0x00,0x0F,0xFF,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 1 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xFE,0x40,0x1D,0x06,0x90,0x30,0x01,0xE0,0x38,0x00,0xF0,0x28,0x00,0xF0,0x00,0x01,0xE0,0x00,0x02,0xD0,0x00,0x07,0x80,0x00,0x1E,0x40,0x00,0x74,0x00,0x01,0xD0,0x00,0x07,0x40,0x30,0x1D,0x00,0x30,0x30,0x00,0x70,0x3F,0xFF,0xF0,0x2F,0xFF,0xE0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 2 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xF9,0x00,0x1D,0x1A,0x40,0x2C,0x07,0x80,0x3C,0x03,0xC0,0x28,0x03,0xC0,0x00,0x07,0x80,0x00,0x1A,0x40,0x00,0xF8,0x00,0x00,0x07,0x80,0x00,0x01,0xD0,0x00,0x00,0xE0,0x28,0x00,0xF0,0x3C,0x00,0xF0,0x2C,0x01,0xE0,0x1D,0x06,0x90,0x07,0xFE,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 3 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xC0,0x00,0x06,0xC0,0x00,0x0B,0xC0,0x00,0x1B,0xC0,0x00,0x73,0xC0,0x00,0xD3,0xC0,0x01,0xC3,0xC0,0x07,0x43,0xC0,0x0D,0x03,0xC0,0x1C,0x03,0xC0,0x30,0x07,0xD0,0x2F,0xFF,0xFC,0x00,0x07,0xD0,0x00,0x03,0xC0,0x00,0x03,0xC0,0x00,0x07,0xD0,0x00,0x3F,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 4 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0B,0xFF,0xE0,0x0F,0xFF,0xE0,0x0D,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0C,0xFE,0x40,0x0F,0x46,0x90,0x0D,0x01,0xE0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x28,0x00,0xF0,0x38,0x01,0xE0,0x30,0x02,0xD0,0x1D,0x07,0x80,0x07,0xFE,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 5 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x90,0x06,0xD1,0xE0,0x0B,0x40,0xA0,0x0E,0x00,0x00,0x1D,0x00,0x00,0x2C,0x00,0x00,0x3C,0x7F,0x90,0x3C,0xD1,0xA4,0x3F,0x40,0x78,0x3D,0x00,0x3C,0x3C,0x00,0x3C,0x2C,0x00,0x3C,0x1D,0x00,0x38,0x0A,0x40,0x74,0x06,0x91,0xE0,0x01,0xBF,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 6 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0xF8,0x0B,0xFF,0xF8,0x0E,0x40,0x34,0x0D,0x00,0xD0,0x0C,0x00,0xC0,0x00,0x01,0xC0,0x00,0x03,0x40,0x00,0x07,0x00,0x00,0x0D,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x2C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 7 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xFF,0x90,0x1A,0x41,0xA4,0x2D,0x00,0x78,0x3C,0x00,0x3C,0x3D,0x00,0x38,0x2E,0x40,0x74,0x1B,0xE5,0xE0,0x00,0xBE,0x00,0x0B,0x5B,0x90,0x1D,0x01,0xA4,0x2C,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x2D,0x00,0x78,0x1B,0x41,0xA4,0x01,0xFF,0x90,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 8 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xFF,0x40,0x0A,0x41,0xD0,0x1E,0x00,0xA0,0x2D,0x00,0x74,0x3C,0x00,0x38,0x3C,0x00,0x3C,0x3C,0x00,0x7C,0x2D,0x01,0xFC,0x1A,0x47,0x3C,0x06,0xFD,0x3C,0x00,0x00,0x78,0x00,0x00,0xB4,0x00,0x00,0xE0,0x0A,0x01,0xD0,0x0B,0x47,0x80,0x06,0xFD,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* 9 */
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x00,0x3F,0x00,0x00,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2E,0x00,0x00,0x3F,0x00,0x00,0x2E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* : */
+};
+const AAFont aafont24x12 = {24, 12, 2, 0x20, 0x3A, aa24x12_data};
 
 const uint8_t bilibiliData[] = {
 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x86, 0x8f, 0x9f, 0xbf, 0xff, 0xfc, 0xf8, 0xf8, 0xe0, 0xe0, 0xc0, 0x80,
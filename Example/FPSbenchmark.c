@@ -27,7 +27,8 @@
 #include "TFTh/TFT_CAD.h" // 包含绘图函数和 IO 函数
 #include "TFTh/TFT_init.h"
 #include "TFTh/TFT_text.h"
-#include <stdio.h>   // 添加 stdio.h 用于 sprintf
+#include "TFTh/TFT_sprite.h"
+#include "TFTh/TFT_image.h" // TFT_Draw_Band 和行带混合函数
 #include <stdlib.h>  // 添加 stdlib.h 用于 rand()
 #include <stdbool.h> // 添加 stdbool.h 用于 bool 类型
 /* USER CODE END Includes */
@@ -39,6 +40,8 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define BALL_SIZE 24      // 弹跳小球精灵的边长
+#define BALL_KEY 0xF81F   // 小球图片的透明色 (品红)
 
 /* USER CODE END PD */
 
@@ -56,9 +59,13 @@ TFT_HandleTypeDef htft2; // 第二个TFT屏幕句柄
 uint32_t frame_count = 0;
 uint32_t start_tick = 0;
 float avg_fps = 0.0f;
-char fps_str[30]; // 用于显示 FPS
 bool test_running = true;
 const uint32_t test_duration_ms = 10000; // 测试持续时间 10 秒
+
+uint8_t ball_pixels[BALL_SIZE * BALL_SIZE * 2]; // 小球精灵的 RGB565 像素 (圆外为透明色)
+uint16_t ball_background = BLACK;               // 精灵场景的背景色
+TFT_Sprite_Scene ball_scene;
+TFT_Sprite ball;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -69,7 +76,76 @@ void SystemClock_Config(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
+/**
+ * @brief  生成小球精灵的图片: 圆内为由亮到暗的黄色，圆外为透明色
+ */
+static void Make_Ball(void)
+{
+  int16_t r = BALL_SIZE / 2;
+
+  for (int16_t y = 0; y < BALL_SIZE; y++)
+  {
+    for (int16_t x = 0; x < BALL_SIZE; x++)
+    {
+      int16_t dx = x - r, dy = y - r;
+      int32_t d2 = dx * dx + dy * dy;
+      uint16_t color = BALL_KEY;
+
+      if (d2 < r * r)
+      {
+        uint16_t level = 31 - (uint16_t)(d2 * 24 / (r * r)); // 中心亮、边缘暗
+        color = (uint16_t)((level << 11) | ((level * 2) << 5));
+      }
+      ball_pixels[(y * BALL_SIZE + x) * 2] = color >> 8;
+      ball_pixels[(y * BALL_SIZE + x) * 2 + 1] = color & 0xFF;
+    }
+  }
+}
 
+
+/**
+ * @brief  行带半透明混合基准: 在 240x8 的行带中重复执行各混合函数，显示每像素耗时
+ * @param  htft TFT句柄指针
+ * @param  y    行带和结果所在的行坐标
+ */
+static void Blend_Benchmark(TFT_HandleTypeDef *htft, int16_t y)
+{
+  const uint16_t width = 240, height = 8, repeat = 200;
+  uint32_t pixels = (uint32_t)width * height * repeat; // 每项测试处理的像素总数
+  uint16_t *band_pixels = (uint16_t *)malloc(width * height * sizeof(uint16_t));
+  uint32_t start, fill_ms, bitmap_ms, text_ms;
+  TFT_Band band;
+
+  if (band_pixels == NULL)
+    return; // 内存不足
+
+  TFT_Band_Init(&band, band_pixels, 0, y, width, height);
+  TFT_Band_Fill(&band, BLUE);
+
+  start = HAL_GetTick();
+  for (uint16_t i = 0; i < repeat; i++)
+    TFT_Band_Blend_Fill(&band, 0, y, width, height, RED, 96);
+  fill_ms = HAL_GetTick() - start;
+
+  start = HAL_GetTick();
+  for (uint16_t i = 0; i < repeat; i++)
+    for (int16_t x = 0; x < width; x += BALL_SIZE)
+      TFT_Band_Blend_Bitmap(&band, x, y - BALL_SIZE / 2 + 4, BALL_SIZE, BALL_SIZE, ball_pixels, 160);
+  bitmap_ms = HAL_GetTick() - start;
+
+  start = HAL_GetTick();
+  for (uint16_t i = 0; i < repeat; i++)
+    TFT_Band_Blend_AA_String(&band, 0, y - 8, (const uint8_t *)"0123456789:01234567", &aafont24x12, WHITE, 200);
+  text_ms = HAL_GetTick() - start;
+
+  TFT_Draw_Band(htft, &band); // 显示最后的混合结果
+  free(band_pixels);
+
+  // 每像素耗时 (纳秒)
+  TFT_Printf(htft, 5, y + 12, WHITE, BLACK, 16, 0, "Fill:   %lu ns/px", fill_ms * 1000000 / pixels);
+  TFT_Printf(htft, 5, y + 30, WHITE, BLACK, 16, 0, "Bitmap: %lu ns/px", bitmap_ms * 1000000 / pixels);
+  TFT_Printf(htft, 5, y + 48, WHITE, BLACK, 16, 0, "Text:   %lu ns/px", text_ms * 1000000 / pixels);
+}
 /* USER CODE END 0 */
 
 /**
@@ -84,7 +160,9 @@ int main(void)
   uint16_t pos_x = 0;
   uint16_t pos_y = 70; // 调整 Y 坐标以适应更大的矩形
   uint16_t rect_color = RED;
-  char frame_str[20]; // 用于显示实时帧数
+  int16_t ball_x = 0, ball_y = 170; // 小球位置
+  int16_t ball_dx = 4, ball_dy = 3; // 小球每帧移动的距离
+  TFT_TextField frame_field1, frame_field2; // 帧数文本框，只重绘变化的数字
   /* USER CODE END 1 */
 
   /* MCU Configuration--------------------------------------------------------*/
@@ -132,6 +210,15 @@ int main(void)
   TFT_Show_String(&htft2, 5, 5, (uint8_t *)"FPS Test Run", WHITE, BLACK, 16, 0);
   TFT_Show_String(&htft2, 5, 25, (uint8_t *)"Large Area", CYAN, BLACK, 16, 0);
 
+  // 第一个屏幕下方的空白区域中有一个弹跳的小球精灵，移动时背景由精灵场景恢复，不需要先擦除
+  Make_Ball();
+  TFT_Sprite_Scene_Init(&ball_scene, TFT_Sprite_Background_Color, &ball_background);
+  TFT_Sprite_Init(&ball, ball_pixels, BALL_SIZE, BALL_SIZE, BALL_KEY);
+  TFT_Sprite_Add(&htft1, &ball_scene, &ball);
+
+  TFT_TextField_Init(&frame_field1, 5, 130, 16, MAGENTA, BLACK);
+  TFT_TextField_Init(&frame_field2, 5, 130, 16, MAGENTA, BLACK);
+
   start_tick = HAL_GetTick(); // 获取测试开始时间
   frame_count = 0;
   test_running = true;
@@ -157,22 +244,17 @@ int main(void)
         // 屏幕1清屏并显示最终结果
         TFT_Fill_Area(&htft1, 0, 0, 128, 160, BLACK);
         TFT_Show_String(&htft1, 5, 5, (uint8_t *)"Test Finished!", GREEN, BLACK, 16, 0);
-        sprintf(fps_str, "Avg FPS: %.1f", avg_fps);
-        TFT_Show_String(&htft1, 5, 25, (uint8_t *)fps_str, YELLOW, BLACK, 16, 0);
-        sprintf(fps_str, "Frames: %lu", frame_count);
-        TFT_Show_String(&htft1, 5, 45, (uint8_t *)fps_str, WHITE, BLACK, 16, 0);
-        sprintf(fps_str, "Time: %lu ms", elapsed_ms);
-        TFT_Show_String(&htft1, 5, 65, (uint8_t *)fps_str, WHITE, BLACK, 16, 0);
+        TFT_Printf(&htft1, 5, 25, YELLOW, BLACK, 16, 0, "Avg FPS: %.1f", avg_fps);
+        TFT_Printf(&htft1, 5, 45, WHITE, BLACK, 16, 0, "Frames: %lu", frame_count);
+        TFT_Printf(&htft1, 5, 65, WHITE, BLACK, 16, 0, "Time: %lu ms", elapsed_ms);
+        Blend_Benchmark(&htft1, 100); // 屏幕1: 行带半透明混合基准
 
         // 屏幕2清屏并显示最终结果
         TFT_Fill_Area(&htft2, 0, 0, 128, 160, BLACK);
         TFT_Show_String(&htft2, 5, 5, (uint8_t *)"Test Finished!", GREEN, BLACK, 16, 0);
-        sprintf(fps_str, "Avg FPS: %.1f", avg_fps);
-        TFT_Show_String(&htft2, 5, 25, (uint8_t *)fps_str, YELLOW, BLACK, 16, 0);
-        sprintf(fps_str, "Frames: %lu", frame_count);
-        TFT_Show_String(&htft2, 5, 45, (uint8_t *)fps_str, WHITE, BLACK, 16, 0);
-        sprintf(fps_str, "Time: %lu ms", elapsed_ms);
-        TFT_Show_String(&htft2, 5, 65, (uint8_t *)fps_str, WHITE, BLACK, 16, 0);
+        TFT_Printf(&htft2, 5, 25, YELLOW, BLACK, 16, 0, "Avg FPS: %.1f", avg_fps);
+        TFT_Printf(&htft2, 5, 45, WHITE, BLACK, 16, 0, "Frames: %lu", frame_count);
+        TFT_Printf(&htft2, 5, 65, WHITE, BLACK, 16, 0, "Time: %lu ms", elapsed_ms);
 
         // 进入停止状态，只闪烁LED
         while (1)
@@ -184,33 +266,51 @@ int main(void)
       else
       {
         // --- 动态图形绘制 (大面积更新) ---
-        // 1. 清除上一个大方块 (用背景色填充)
-        TFT_Fill_Area(&htft1, pos_x, pos_y, pos_x + rect_size, pos_y + rect_size, BLACK);
-        TFT_Fill_Area(&htft2, pos_x, pos_y, pos_x + rect_size, pos_y + rect_size, BLACK);
+        // 1. 记住上一个大方块的位置
+        TFT_Rect old_rect = {pos_x, pos_y, rect_size, rect_size};
 
         // 2. 更新位置和颜色
         pos_x = (pos_x + 3) % (128 - rect_size); // 在屏幕宽度内移动，留出方块宽度
+        TFT_Rect new_rect = {pos_x, pos_y, rect_size, rect_size};
         if (frame_count % 30 == 0)
         {                               // 每 30 帧改变一次颜色
           rect_color = rand() % 0xFFFF; // 随机颜色
+          // 颜色改变时整个方块都要重绘: 擦除旧方块，旧位置视为空矩形
+          TFT_Fill_Area(&htft1, old_rect.x, old_rect.y, old_rect.x + rect_size, old_rect.y + rect_size, BLACK);
+          TFT_Fill_Area(&htft2, old_rect.x, old_rect.y, old_rect.x + rect_size, old_rect.y + rect_size, BLACK);
+          old_rect.width = 0;
         }
 
-        // 3. 绘制新的大方块
-        TFT_Fill_Area(&htft1, pos_x, pos_y, pos_x + rect_size, pos_y + rect_size, rect_color);
-        TFT_Fill_Area(&htft2, pos_x, pos_y, pos_x + rect_size, pos_y + rect_size, rect_color);
+        // 3. 移动大方块: 只填充露出的背景条和新覆盖的条 (每帧 2 条 3x60，而不是 2 个 60x60)
+        TFT_Move_Rect(&htft1, &old_rect, &new_rect, rect_color, BLACK);
+        TFT_Move_Rect(&htft2, &old_rect, &new_rect, rect_color, BLACK);
+
+        // 4. 移动小球精灵 (在第一个屏幕 y = 170 ~ 319 的区域内反弹)
+        ball_x += ball_dx;
+        ball_y += ball_dy;
+        if (ball_x < 0 || ball_x > 240 - BALL_SIZE)
+        {
+          ball_dx = -ball_dx;
+          ball_x += 2 * ball_dx;
+        }
+        if (ball_y < 170 || ball_y > 320 - BALL_SIZE)
+        {
+          ball_dy = -ball_dy;
+          ball_y += 2 * ball_dy;
+        }
+        TFT_Sprite_Move(&htft1, &ball_scene, &ball, ball_x, ball_y);
 
-        // 4. 绘制一个简单的进度条指示测试时间
+        // 5. 绘制一个简单的进度条指示测试时间
         uint16_t progress_width = (uint16_t)(((float)elapsed_ms / test_duration_ms) * 128);
         TFT_Fill_Area(&htft1, 0, 150, progress_width, 159, BLUE);   // 底部蓝色进度条
         TFT_Fill_Area(&htft1, progress_width, 150, 128, 159, GRAY); // 剩余部分灰色
         TFT_Fill_Area(&htft2, 0, 150, progress_width, 159, BLUE);
         TFT_Fill_Area(&htft2, progress_width, 150, 128, 159, GRAY);
 
-        // 5. 显示实时帧数 (会稍微影响性能，但有助于观察)
-        sprintf(frame_str, "Frame: %lu", frame_count);
-        // 在一个固定区域显示帧数，使用背景色覆盖旧的数字
-        TFT_Show_String(&htft1, 5, 130, (uint8_t *)frame_str, MAGENTA, BLACK, 16, 0);
-        TFT_Show_String(&htft2, 5, 130, (uint8_t *)frame_str, MAGENTA, BLACK, 16, 0);
+        // 6. 显示实时帧数 (会稍微影响性能，但有助于观察)
+        // 在一个固定区域显示帧数，文本框只重绘与上一帧不同的字符 (通常只有最后一位)
+        TFT_TextField_Printf(&htft1, &frame_field1, "Frame: %lu", frame_count);
+        TFT_TextField_Printf(&htft2, &frame_field2, "Frame: %lu", frame_count);
         // --- 动态图形绘制结束 ---
 
         frame_count++; // 帧计数增加
@@ -28,8 +28,6 @@
 #include "TFTh/TFT_init.h"
 #include "TFTh/TFT_text.h"
 #include "TFTh/TFT_io.h" // 包含RGB转换函数
-#include <stdio.h>       // 添加 stdio.h 用于 sprintf
-#include <math.h>        // 添加 math.h 用于三角函数
 
 /* USER CODE END Includes */
 
@@ -42,11 +40,11 @@
 /* USER CODE BEGIN PD */
 #define SCREEN_WIDTH  128 // TFT屏幕宽度
 #define SCREEN_HEIGHT 160 // TFT屏幕高度
-#define PI 3.14159265358979323846f
 
 // 定义第二个屏幕的CS引脚 (仅用于演示，应根据实际硬件配置)
 #define TFT2_CS_GPIO_Port GPIOB
 #define TFT2_CS_Pin       GPIO_PIN_0
+#define BAR_CHART_MAX_BARS 16 // 条形图最多条形数量
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -60,11 +58,12 @@
 TFT_HandleTypeDef htft1; // 第一个TFT屏幕句柄
 TFT_HandleTypeDef htft2; // 第二个TFT屏幕句柄
 
-char textBuf[32]; // 文本缓冲区
 uint16_t angle = 0; // 动画角度
 uint32_t frameCount = 0; // 帧计数器
 uint32_t lastTick = 0;   // 上次计时点
 float fps = 0;          // 帧率
+TFT_TextField fpsField;   // 帧率文本框
+TFT_TextField frameField; // 帧计数文本框
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -110,6 +109,10 @@ void TFT_Demo_Init(void)
     htft1.buffer_size = 4096; // 第一屏使用较大缓冲
     htft2.buffer_size = 2048; // 第二屏使用较小缓冲
     
+    // 初始化帧率和帧计数文本框
+    TFT_TextField_Init(&fpsField, 20, 80, 8, GREEN, BLACK);
+    TFT_TextField_Init(&frameField, 20, 90, 8, GREEN, BLACK);
+
     // 初始化帧率计时
     lastTick = HAL_GetTick();
 }
@@ -120,8 +123,9 @@ void TFT_Demo_Init(void)
  */
 void TFT_Demo_Screen1(void)
 {
-    // 清屏为黑色
-    TFT_Fill_Area(&htft1, 0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, BLACK);
+    // 清屏为黑色 (跳过文本框所在的行，文本框只重绘变化的字符)
+    TFT_Fill_Area(&htft1, 0, 0, SCREEN_WIDTH - 1, 80, BLACK);
+    TFT_Fill_Area(&htft1, 0, 98, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, BLACK);
     
     // 绘制标题
     TFT_Show_String(&htft1, 20, 5, (uint8_t *)"Screen #1", WHITE, BLACK, 12, 0);
@@ -133,12 +137,10 @@ void TFT_Demo_Screen1(void)
     TFT_Draw_Clock(&htft1, 64, 45, 25, WHITE);
     
     // 绘制帧率文本
-    sprintf(textBuf, "FPS: %.1f", fps);
-    TFT_Show_String(&htft1, 20, 80, (uint8_t *)textBuf, GREEN, BLACK, 8, 0);
+    TFT_TextField_Printf(&htft1, &fpsField, "FPS: %.1f", fps);
     
     // 绘制帧计数器
-    sprintf(textBuf, "Frame: %lu", frameCount);
-    TFT_Show_String(&htft1, 20, 90, (uint8_t *)textBuf, GREEN, BLACK, 8, 0);
+    TFT_TextField_Printf(&htft1, &frameField, "Frame: %lu", frameCount);
     
     // 绘制条形图数据
     uint16_t values[5] = {10 + (frameCount % 30), 20 + (frameCount % 20), 
@@ -166,12 +168,12 @@ void TFT_Demo_Screen2(void)
     TFT_Draw_Animation(&htft2, 64, 45, 30, YELLOW);
     
     // 绘制三角形，随角度变化
-    uint16_t x1 = 64 + 40 * cos(angle * PI / 180.0f);
-    uint16_t y1 = 100 + 20 * sin(angle * PI / 180.0f);
-    uint16_t x2 = 64 + 40 * cos((angle + 120) * PI / 180.0f);
-    uint16_t y2 = 100 + 20 * sin((angle + 120) * PI / 180.0f);
-    uint16_t x3 = 64 + 40 * cos((angle + 240) * PI / 180.0f);
-    uint16_t y3 = 100 + 20 * sin((angle + 240) * PI / 180.0f);
+    uint16_t x1 = 64 + (40 * TFT_Cos(angle) >> 15);
+    uint16_t y1 = 100 + (20 * TFT_Sin(angle) >> 15);
+    uint16_t x2 = 64 + (40 * TFT_Cos(angle + 120) >> 15);
+    uint16_t y2 = 100 + (20 * TFT_Sin(angle + 120) >> 15);
+    uint16_t x3 = 64 + (40 * TFT_Cos(angle + 240) >> 15);
+    uint16_t y3 = 100 + (20 * TFT_Sin(angle + 240) >> 15);
     
     TFT_Draw_Triangle(&htft2, x1, y1, x2, y2, x3, y3, GREEN);
     
@@ -195,30 +197,30 @@ void TFT_Draw_Clock(TFT_HandleTypeDef *htft, uint16_t centerX, uint16_t centerY,
     
     // 绘制时钟刻度
     for (i = 0; i < 12; i++) {
-        float angle = i * 30.0f * PI / 180.0f;
-        uint16_t x1 = centerX + (radius - 5) * cos(angle);
-        uint16_t y1 = centerY + (radius - 5) * sin(angle);
-        uint16_t x2 = centerX + radius * cos(angle);
-        uint16_t y2 = centerY + radius * sin(angle);
+        int16_t angle = i * 30;
+        uint16_t x1 = centerX + ((radius - 5) * TFT_Cos(angle) >> 15);
+        uint16_t y1 = centerY + ((radius - 5) * TFT_Sin(angle) >> 15);
+        uint16_t x2 = centerX + (radius * TFT_Cos(angle) >> 15);
+        uint16_t y2 = centerY + (radius * TFT_Sin(angle) >> 15);
         TFT_Draw_Line(htft, x1, y1, x2, y2, color);
     }
     
     // 绘制时针（基于angle值旋转）
-    float hourAngle = (angle / 30.0f) * PI / 180.0f; // 每12秒转一圈
-    uint16_t hourX = centerX + (radius - 10) * cos(hourAngle);
-    uint16_t hourY = centerY + (radius - 10) * sin(hourAngle);
-    TFT_Draw_Line(htft, centerX, centerY, hourX, hourY, RED);
+    int16_t hourAngle = angle / 30; // 每12秒转一圈
+    uint16_t hourX = centerX + ((radius - 10) * TFT_Cos(hourAngle) >> 15);
+    uint16_t hourY = centerY + ((radius - 10) * TFT_Sin(hourAngle) >> 15);
+    TFT_Draw_Thick_Line(htft, centerX, centerY, hourX, hourY, 3, TFT_CAP_ROUND, RED);
     
     // 绘制分针（基于angle值旋转，比时针快）
-    float minAngle = (angle * 5 / 30.0f) * PI / 180.0f; // 每2.4秒转一圈
-    uint16_t minX = centerX + (radius - 5) * cos(minAngle);
-    uint16_t minY = centerY + (radius - 5) * sin(minAngle);
-    TFT_Draw_Line(htft, centerX, centerY, minX, minY, GREEN);
+    int16_t minAngle = angle * 5 / 30; // 每2.4秒转一圈
+    uint16_t minX = centerX + ((radius - 5) * TFT_Cos(minAngle) >> 15);
+    uint16_t minY = centerY + ((radius - 5) * TFT_Sin(minAngle) >> 15);
+    TFT_Draw_Thick_Line(htft, centerX, centerY, minX, minY, 2, TFT_CAP_ROUND, GREEN);
     
     // 绘制秒针（基于angle值旋转，最快）
-    float secAngle = (angle * 12 / 30.0f) * PI / 180.0f; // 每秒转一圈
-    uint16_t secX = centerX + radius * cos(secAngle);
-    uint16_t secY = centerY + radius * sin(secAngle);
+    int16_t secAngle = angle * 12 / 30; // 每秒转一圈
+    uint16_t secX = centerX + (radius * TFT_Cos(secAngle) >> 15);
+    uint16_t secY = centerY + (radius * TFT_Sin(secAngle) >> 15);
     TFT_Draw_Line(htft, centerX, centerY, secX, secY, YELLOW);
     
     // 绘制时钟中心点
@@ -242,6 +244,10 @@ void TFT_Draw_Bar_Chart(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint16_
     uint8_t i;
     uint16_t barWidth = width / valueCount;
     uint16_t maxValue = 0;
+    TFT_Rect bars[BAR_CHART_MAX_BARS];
+
+    if (valueCount > BAR_CHART_MAX_BARS)
+        valueCount = BAR_CHART_MAX_BARS;
     
     // 查找最大值
     for (i = 0; i < valueCount; i++) {
@@ -253,14 +259,15 @@ void TFT_Draw_Bar_Chart(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint16_
     TFT_Draw_Line(htft, x, y + height, x + width, y + height, WHITE); // X轴
     TFT_Draw_Line(htft, x, y, x, y + height, WHITE);                 // Y轴
     
-    // 绘制条形
+    // 绘制条形 (一次批量提交)
     for (i = 0; i < valueCount; i++) {
         uint16_t barHeight = (values[i] * height) / (maxValue + 5); // +5避免高度为0
         uint16_t barX = x + i * barWidth + 1;
         uint16_t barY = y + height - barHeight;
         
-        TFT_Fill_Rectangle(htft, barX, barY, barX + barWidth - 2, y + height - 1, colors[i]);
+        bars[i] = (TFT_Rect){barX, barY, barWidth - 1, barHeight};
     }
+    TFT_Fill_Rects(htft, bars, colors, valueCount);
 }
 
 /**
@@ -276,11 +283,11 @@ void TFT_Draw_Animation(TFT_HandleTypeDef *htft, uint16_t x, uint16_t y, uint16_
 {
     int i;
     for (i = 0; i < 12; i++) {
-        float ang = (i * 30.0f + angle) * PI / 180.0f;
-        uint16_t x1 = x + (size - 10) * cos(ang);
-        uint16_t y1 = y + (size - 10) * sin(ang);
-        uint16_t x2 = x + size * cos(ang);
-        uint16_t y2 = y + size * sin(ang);
+        int16_t ang = (i * 30 + angle) % 360;
+        uint16_t x1 = x + ((size - 10) * TFT_Cos(ang) >> 15);
+        uint16_t y1 = y + ((size - 10) * TFT_Sin(ang) >> 15);
+        uint16_t x2 = x + (size * TFT_Cos(ang) >> 15);
+        uint16_t y2 = y + (size * TFT_Sin(ang) >> 15);
         
         uint8_t intensity = ((i + angle / 30) % 12) * 255 / 12;
         uint16_t dotColor = TFT_RGB(intensity, intensity, color >> 8);
@@ -343,6 +350,7 @@ int main(void)
   
   // 启动延时
   HAL_Delay(1000);
+  TFT_Fill_Area(&htft1, 0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1, BLACK); // 清除启动信息，之后每帧跳过文本框所在的行
   
   /* USER CODE END 2 */
 
@@ -0,0 +1,124 @@
+/*
+ * 半透明混合 (TFT_blend.c) PC 端测试和基准程序
+ *
+ * 编译: gcc -O2 -I Core/Inc Tools/blend_bench.c Core/Src/TFTc/TFT_blend.c -o blend_bench
+ * 用法: ./blend_bench [重复次数]
+ *
+ * 在 240x40 的行带中分别测试半透明填充、固定不透明度位图、4 位不透明度位图和抗锯齿文字，
+ * 输出平均耗时和每秒处理的像素数，并与逐通道拆开计算的参考实现比较结果和速度。
+ * PC 上的耗时只用于比较不同实现之间的相对快慢，MCU 上的实际耗时需要在目标板上测量 (见 Example/FPSbenchmark.c)。
+ */
+#include "TFTh/TFT_blend.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BAND_WIDTH 240
+#define BAND_HEIGHT 40
+#define PIXELS (BAND_WIDTH * BAND_HEIGHT)
+
+static uint16_t band_pixels[PIXELS];
+static uint16_t reference[PIXELS];
+static uint8_t bitmap[PIXELS * 2];  // RGB565 位图 (高字节在前)
+static uint8_t alpha4[PIXELS / 2];  // 4 位不透明度
+static uint8_t glyphs[11 * 24 * 6]; // 测试字体: 11 个 24x12 的 4 位字模
+static const AAFont font = {24, 12, 4, '0', ':', glyphs};
+
+/**
+ * @brief 逐通道拆开计算的参考混合 (alpha 为 0 ~ 32 级)
+ */
+static uint16_t blend_reference(uint16_t fg, uint16_t bg, uint32_t alpha)
+{
+    uint32_t r = ((fg >> 11) * alpha + (bg >> 11) * (32 - alpha)) >> 5;
+    uint32_t g = (((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * (32 - alpha)) >> 5;
+    uint32_t b = ((fg & 0x1F) * alpha + (bg & 0x1F) * (32 - alpha)) >> 5;
+
+    return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+static void reset(void)
+{
+    for (uint32_t i = 0; i < PIXELS; i++)
+        band_pixels[i] = reference[i] = (uint16_t)(i * 2654435761u >> 16);
+}
+
+static void report(const char *name, double elapsed, int repeat, uint32_t pixels)
+{
+    double per_call = elapsed / repeat;
+
+    printf("%-22s: %8.2f us, %7.1f Mpixel/s\n", name, per_call * 1000.0, pixels / per_call / 1000.0);
+}
+
+int main(int argc, char **argv)
+{
+    int repeat = argc > 1 ? atoi(argv[1]) : 2000;
+    TFT_Band band;
+    double start;
+    int errors = 0;
+
+    srand(1);
+    for (uint32_t i = 0; i < sizeof(bitmap); i++)
+        bitmap[i] = (uint8_t)rand();
+    for (uint32_t i = 0; i < sizeof(alpha4); i++)
+        alpha4[i] = (uint8_t)rand();
+    for (uint32_t i = 0; i < sizeof(glyphs); i++)
+        glyphs[i] = (uint8_t)(rand() & rand()); // 偏向低覆盖率，接近真实字模
+    TFT_Band_Init(&band, band_pixels, 0, 0, BAND_WIDTH, BAND_HEIGHT);
+
+    // 正确性: 与参考实现逐像素比较
+    for (uint32_t alpha = 0; alpha < 256; alpha++)
+    {
+        reset();
+        TFT_Band_Blend_Bitmap(&band, 0, 0, BAND_WIDTH, BAND_HEIGHT, bitmap, (uint8_t)alpha);
+        for (uint32_t i = 0; i < PIXELS; i++)
+        {
+            uint16_t fg = (uint16_t)(bitmap[i * 2] << 8) | bitmap[i * 2 + 1];
+            if ((alpha + 4) >> 3 != 0 && band_pixels[i] != blend_reference(fg, reference[i], (alpha + 4) >> 3))
+                errors++;
+        }
+    }
+    printf("bitmap blend vs reference: %d mismatches\n", errors);
+
+    reset();
+    start = now_ms();
+    for (int i = 0; i < repeat; i++)
+        TFT_Band_Blend_Fill(&band, 0, 0, BAND_WIDTH, BAND_HEIGHT, (uint16_t)(0x1234 + i), 100);
+    report("fill alpha 100", now_ms() - start, repeat, PIXELS);
+
+    start = now_ms();
+    for (int i = 0; i < repeat; i++)
+    {
+        uint16_t color = (uint16_t)(0x1234 + i);
+        for (uint32_t p = 0; p < PIXELS; p++)
+            reference[p] = blend_reference(color, reference[p], 13);
+    }
+    report("fill (per-channel ref)", now_ms() - start, repeat, PIXELS);
+
+    start = now_ms();
+    for (int i = 0; i < repeat; i++)
+        TFT_Band_Blend_Bitmap(&band, 0, 0, BAND_WIDTH, BAND_HEIGHT, bitmap, (uint8_t)(i | 1));
+    report("bitmap constant alpha", now_ms() - start, repeat, PIXELS);
+
+    start = now_ms();
+    for (int i = 0; i < repeat; i++)
+        TFT_Band_Blend_Bitmap_A4(&band, 0, 0, BAND_WIDTH, BAND_HEIGHT, bitmap, alpha4);
+    report("bitmap 4-bit alpha", now_ms() - start, repeat, PIXELS);
+
+    start = now_ms();
+    for (int i = 0; i < repeat; i++)
+    {
+        TFT_Band_Blend_AA_String(&band, 0, 0, (const uint8_t *)"0123456789:0123456789", &font, 0xFFE0, 255);
+        TFT_Band_Blend_AA_String(&band, 0, 16, (const uint8_t *)"9876543210:9876543210", &font, 0x07FF, 160);
+    }
+    report("AA text (2 lines)", now_ms() - start, repeat, 2 * BAND_WIDTH * 24); // 行带宽度内的 20 个字
+
+    printf("checksum %04X\n", band_pixels[PIXELS / 2] ^ reference[PIXELS / 3]);
+    return errors != 0;
+}
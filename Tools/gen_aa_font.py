@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+"""
+生成抗锯齿字体 (AAFont) 数据
+
+从 font.c 中的 24x12 ASCII 字库 (列行式) 取出指定范围的字符，用 EPX (Scale2x) 放大两次
+(4 倍) 使斜线和圆弧变平滑，再按 4x4 像素取平均得到每个像素的覆盖率，量化为 2 或 4 位灰度，
+按 AAFont 格式输出 C 数组，粘贴到 font.c 中使用。
+
+AAFont 字模格式: 逐行存放，每行 ceil(w*bpp/8) 字节，一个字节内先出现的像素在高位。
+
+用法: python3 Tools/gen_aa_font.py Core/Src/TFTc/font.c [bpp] > aa24x12.c
+"""
+import re
+import sys
+
+W, H = 12, 24
+FIRST, LAST = ord(" "), ord(":")  # 空格、常用符号和数字
+
+
+def load_24x12(path):
+    text = open(path, encoding="utf-8").read()
+    body = text[text.index("ascii_24x12"):]
+    body = body[:body.index("};")]
+    glyphs = []
+    for row in re.findall(r"\{([^{}]*)\}", body):
+        data = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", row)]
+        if len(data) == 36:
+            glyphs.append(data)
+    return glyphs
+
+
+def bitmap(data):
+    # 列行式: 每 8 行一页，页内每列 1 字节，LSB 在上
+    return [[(data[(r >> 3) * W + c] >> (r & 7)) & 1 for c in range(W)] for r in range(H)]
+
+
+def epx(img):
+    h, w = len(img), len(img[0])
+    get = lambda y, x: img[y][x] if 0 <= y < h and 0 <= x < w else 0
+    out = [[0] * (w * 2) for _ in range(h * 2)]
+    for y in range(h):
+        for x in range(w):
+            p = img[y][x]
+            a, b, c, d = get(y - 1, x), get(y, x + 1), get(y, x - 1), get(y + 1, x)
+            e = [p] * 4
+            if c == a and c != d and a != b:
+                e[0] = a
+            if a == b and a != c and b != d:
+                e[1] = b
+            if d == c and d != b and c != a:
+                e[2] = c
+            if b == d and b != a and d != c:
+                e[3] = d
+            out[y * 2][x * 2], out[y * 2][x * 2 + 1] = e[0], e[1]
+            out[y * 2 + 1][x * 2], out[y * 2 + 1][x * 2 + 1] = e[2], e[3]
+    return out
+
+
+def main():
+    bpp = int(sys.argv[2]) if len(sys.argv) > 2 else 2
+    levels = (1 << bpp) - 1
+    glyphs = load_24x12(sys.argv[1])
+    data = []
+    for code in range(FIRST, LAST + 1):
+        big = epx(epx(bitmap(glyphs[code - FIRST])))
+        out = []
+        for r in range(H):
+            bits = 0
+            nbits = 0
+            row = []
+            for c in range(W):
+                cover = sum(big[r * 4 + i][c * 4 + j] for i in range(4) for j in range(4))
+                level = (cover * levels + 8) // 16
+                bits = (bits << bpp) | level
+                nbits += bpp
+                if nbits == 8:
+                    row.append(bits)
+                    bits = nbits = 0
+            if nbits:
+                row.append(bits << (8 - nbits))
+            out += row
+        data.append((code, out))
+
+    print("// 24x12 抗锯齿字体 (%d 位灰度)，由 Tools/gen_aa_font.py 从 ascii_24x12 生成" % bpp)
+    print("const uint8_t aa24x12_data[] = {")
+    for code, out in data:
+        print("    " + ",".join("0x%02X" % b for b in out) + ", /* %s */" % chr(code))
+    print("};")
+    print("const AAFont aafont24x12 = {%d, %d, %d, 0x%02X, 0x%02X, aa24x12_data};" % (H, W, bpp, FIRST, LAST))
+
+
+if __name__ == "__main__":
+    main()
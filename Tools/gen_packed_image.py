@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""
+生成 QOI 风格压缩的 RGB565 图片 (PackedImage) 数据
+
+读入图片 (PPM/P6 直接读取，其他格式需要安装 Pillow)，转换为 RGB565 后按 PackedImage 格式编码，
+输出 C 数组，粘贴到工程中用 TFT_Draw_Packed_Image 显示。
+
+PackedImage 编码 (逐像素从左到右、从上到下，解码状态: 上一个像素 prev = 0x0000、64 项最近颜色表):
+    0b00iiiiii            INDEX  颜色表第 i 项
+    0b01rrggbb            DIFF   与 prev 的 R/G/B 差值各 -2~1 (存放值 = 差值 + 2)
+    0b10gggggg 0brrrrbbbb LUMA   G 差值 -32~31 (+32)，R、B 差值减去 G 差值后各 -8~7 (+8)
+    0b11nnnnnn            RUN    重复 prev n+1 次 (n = 0~61)
+    0xFE hi lo            RGB    RGB565 原值 (高字节在前)
+差值按通道位数 (R 5 位、G 6 位、B 5 位) 取模。每个解码出的像素 p 写入颜色表第 (r*3 + g*5 + b*7) % 64 项。
+
+用法: python3 Tools/gen_packed_image.py logo.ppm logo > logo.c
+"""
+import sys
+
+
+def load_rgb(path):
+    data = open(path, "rb").read()
+    if data[:2] == b"P6":
+        # 二进制 PPM: 头部为 P6 宽 高 最大值，之后是 RGB 数据
+        fields = []
+        pos = 2
+        while len(fields) < 3:
+            while data[pos:pos + 1].isspace():
+                pos += 1
+            if data[pos:pos + 1] == b"#":
+                pos = data.index(b"\n", pos)
+                continue
+            end = pos
+            while not data[end:end + 1].isspace():
+                end += 1
+            fields.append(int(data[pos:end]))
+            pos = end
+        w, h, maxval = fields
+        pixels = data[pos + 1:pos + 1 + w * h * 3]
+        if maxval != 255:
+            pixels = bytes(v * 255 // maxval for v in pixels)
+        return w, h, [tuple(pixels[i:i + 3]) for i in range(0, w * h * 3, 3)]
+
+    from PIL import Image  # 其他格式使用 Pillow
+
+    img = Image.open(path).convert("RGB")
+    return img.width, img.height, list(img.getdata())
+
+
+def to565(rgb):
+    r, g, b = rgb
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def split(p):
+    return p >> 11, (p >> 5) & 63, p & 31
+
+
+def hash565(p):
+    r, g, b = split(p)
+    return (r * 3 + g * 5 + b * 7) % 64
+
+
+def wrap(v, bits):
+    # 按通道位数取模后换算为有符号差值
+    v &= (1 << bits) - 1
+    return v - (1 << bits) if v >= 1 << (bits - 1) else v
+
+
+def encode(pixels):
+    out = bytearray()
+    index = [0] * 64
+    prev = 0
+    run = 0
+    for p in pixels:
+        if p == prev:
+            run += 1
+            if run == 62:
+                out.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(0xC0 | (run - 1))
+            run = 0
+
+        h = hash565(p)
+        if index[h] == p:
+            out.append(h)
+        else:
+            r0, g0, b0 = split(prev)
+            r1, g1, b1 = split(p)
+            dr, dg, db = wrap(r1 - r0, 5), wrap(g1 - g0, 6), wrap(b1 - b0, 5)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -32 <= dg <= 31 and -8 <= dr - dg <= 7 and -8 <= db - dg <= 7:
+                out.append(0x80 | (dg + 32))
+                out.append(((dr - dg + 8) << 4) | (db - dg + 8))
+            else:
+                out += bytes((0xFE, p >> 8, p & 0xFF))
+        index[h] = p
+        prev = p
+    if run:
+        out.append(0xC0 | (run - 1))
+    return out
+
+
+def main():
+    w, h, rgb = load_rgb(sys.argv[1])
+    name = sys.argv[2] if len(sys.argv) > 2 else "image"
+    data = encode([to565(p) for p in rgb])
+
+    print("// %dx%d RGB565 图片 (QOI 风格压缩，原始 %d 字节)，由 Tools/gen_packed_image.py 生成" % (w, h, w * h * 2))
+    print("const uint8_t %s_data[] = {" % name)
+    for i in range(0, len(data), 16):
+        print("    " + ",".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    print("};")
+    print("const PackedImage %s = {%d, %d, %s_data, sizeof(%s_data)};" % (name, w, h, name, name))
+    sys.stderr.write("%dx%d: %d -> %d bytes (%.1f%%)\n" % (w, h, w * h * 2, len(data), 100.0 * len(data) / (w * h * 2)))
+
+
+if __name__ == "__main__":
+    main()
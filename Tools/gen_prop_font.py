@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+"""
+生成比例字体 (PropFont) 数据
+
+从 font.c 中逐行取模的 16x8 ASCII 字库裁出每个字的包围盒，按 PropFont 格式
+(包围盒字模 + 逐字步进宽度 + 字距调整表) 输出 C 数组，粘贴到 font.c 中使用。
+
+包围盒内的像素按位流编码 (LSB 在前，每个字从整字节开始): 第一行直接存 width 位，
+以后每行先存 1 位，为 1 表示与上一行相同，为 0 时后跟该行的 width 位。
+16 像素高的字竖笔画多，重复的行只占 1 位，比逐像素位图省约 1/4。
+字表每项 4 字节 (见 font.h 中的 PropGlyph)，字模数据最多 4096 字节。
+
+用法: python3 Tools/gen_prop_font.py Core/Src/TFTc/font.c > prop16.c
+"""
+import re
+import sys
+
+FIRST, LAST = 0x20, 0x7E
+HEIGHT = 16
+SPACE_ADVANCE = 4  # 空格步进宽度
+KERN_LEFT = "AFLPTVWY"       # 参与字距调整的左侧字符
+KERN_RIGHT = "ATVWYaceo.,"   # 参与字距调整的右侧字符
+
+
+def load_16x8(path):
+    text = open(path, encoding="utf-8").read()
+    body = text[text.index("ascii_16x8"):]
+    body = body[:body.index("};")]
+    rows = re.findall(r"\{([^{}]*)\}", body)
+    glyphs = []
+    for row in rows:
+        data = [int(v, 16) for v in re.findall(r"0x[0-9A-Fa-f]{2}", row)]
+        if len(data) == 16:
+            glyphs.append(data)
+    return glyphs
+
+
+def bitmap(data):
+    # 逐行式，LSB 在左
+    return [[(data[r] >> c) & 1 for c in range(8)] for r in range(HEIGHT)]
+
+
+def bbox(bits):
+    cols = [c for c in range(8) if any(bits[r][c] for r in range(HEIGHT))]
+    rows = [r for r in range(HEIGHT) if any(bits[r])]
+    if not cols:
+        return None
+    return min(cols), max(cols), min(rows), max(rows)
+
+
+def encode_rows(rows):
+    """按 PropGlyph 的位流格式编码包围盒内的各行像素"""
+    bits = list(rows[0])
+    for prev, row in zip(rows, rows[1:]):
+        if row == prev:
+            bits.append(1)
+        else:
+            bits.append(0)
+            bits += row
+    out = [0] * ((len(bits) + 7) // 8)
+    for i, b in enumerate(bits):
+        out[i >> 3] |= b << (i & 7)
+    return out
+
+
+def profile(bits, box, right):
+    """每行最右 (right=True) 或最左像素到包围盒边缘的空白列数，空行为 None"""
+    x0, x1, _, _ = box
+    result = []
+    for r in range(HEIGHT):
+        cols = [c for c in range(x0, x1 + 1) if bits[r][c]]
+        if not cols:
+            result.append(None)
+        else:
+            result.append(x1 - max(cols) if right else min(cols) - x0)
+    return result
+
+
+def check_glyph(code, offset, width, height, x_offset, y_offset, advance):
+    """检查字表项能否装入 4 字节的 PropGlyph，超出范围时报错退出而不是被截断"""
+    limits = (
+        ("offset", offset, 0, 4095, "字模数据超过 12 位偏移的范围"),
+        ("width", width, 0, 15, "包围盒宽度只有 4 位"),
+        ("height", height, 1, 16, "包围盒高度按 height - 1 存 4 位"),
+        ("x_offset", x_offset, -8, 7, "左边偏移为 4 位有符号数"),
+        ("y_offset", y_offset, 0, 15, "上边偏移只有 4 位"),
+        ("advance", advance, 0, 15, "步进宽度只有 4 位"),
+    )
+    for name, value, low, high, reason in limits:
+        if not low <= value <= high:
+            sys.exit("字符 %r 的 %s = %d 超出 %d ~ %d (%s)" % (chr(code), name, value, low, high, reason))
+
+
+def main():
+    glyphs = load_16x8(sys.argv[1])
+    data = []
+    table = []
+    boxes = {}
+    for code in range(FIRST, LAST + 1):
+        bits = bitmap(glyphs[code - FIRST])
+        box = bbox(bits)
+        if box is None:
+            table.append((len(data), 0, 1, 0, 0, SPACE_ADVANCE))
+            continue
+        x0, x1, y0, y1 = box
+        boxes[code] = (bits, box)
+        rows = [[bits[r][c] for c in range(x0, x1 + 1)] for r in range(y0, y1 + 1)]
+        width = x1 - x0 + 1
+        table.append((len(data), width, y1 - y0 + 1, 0, y0, width + 1))
+        data += encode_rows(rows)
+    for code, g in zip(range(FIRST, LAST + 1), table):
+        check_glyph(code, *g)
+
+    # 字距调整: 相邻两字最近处的空白超过 2 列时收紧 1 列
+    kerning = []
+    for left in KERN_LEFT:
+        for right in KERN_RIGHT:
+            lb, rb = boxes[ord(left)], boxes[ord(right)]
+            lp = profile(lb[0], lb[1], True)
+            rp = profile(rb[0], rb[1], False)
+            gaps = [a + b + 1 for a, b in zip(lp, rp) if a is not None and b is not None]
+            if gaps and min(gaps) > 2:
+                kerning.append((ord(left), ord(right), -1))
+    kerning.sort()
+
+    print("// 16 像素高比例字体，由 Tools/gen_prop_font.py 从 ascii_16x8 生成")
+    print("const uint8_t prop16_bitmap[] = {")
+    for i in range(0, len(data), 16):
+        print("    " + ",".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    print("};")
+    print("const PropGlyph prop16_glyphs[] = {")
+    for code, g in zip(range(FIRST, LAST + 1), table):
+        name = chr(code).replace("\\", "\\\\")
+        print("    PROP_GLYPH(%d, %d, %d, %d, %d, %d), /* %s */" % (g + (name,)))
+    print("};")
+    print("const PropKern prop16_kerning[] = {")
+    for left, right, adjust in kerning:
+        print("    {'%s', '%s', %d}," % (chr(left).replace("'", "\\'"), chr(right).replace("'", "\\'"), adjust))
+    print("};")
+    print("const PropFont pfont16 = {%d, 0x%02X, 0x%02X, prop16_glyphs, prop16_bitmap, prop16_kerning, %d};"
+          % (HEIGHT, FIRST, LAST, len(kerning)))
+    sys.stderr.write("bitmap %d bytes, glyphs %d bytes, kerning %d bytes (%d pairs), total %d bytes\n"
+                     % (len(data), len(table) * 4, len(kerning) * 3, len(kerning),
+                        len(data) + len(table) * 4 + len(kerning) * 3))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""
+生成图块地图 (TFT_Tilemap) 数据
+
+读入图片 (宽高为图块边长的整数倍，读取方式同 gen_packed_image.py)，切成 8x8 或 16x16 的图块，
+相同的图块只保存一份，输出图块数据、16 色调色板和地图，粘贴到工程中用 TFT_Tilemap_Init 初始化。
+
+图块数据: 每像素 4 位调色板序号，逐行存放，高 4 位在左。图片超过 16 种颜色时保留出现最多的 16 种，
+其余像素取最接近的颜色。地图每格 1 字节，最多 256 种图块。
+
+用法: python3 Tools/gen_tilemap.py menu.ppm menu 16 > menu.c
+"""
+import sys
+
+from gen_packed_image import load_rgb, split, to565
+
+
+def nearest(p, palette):
+    r, g, b = split(p)
+    return min(range(len(palette)),
+               key=lambda i: (split(palette[i])[0] - r) ** 2 * 4 + (split(palette[i])[1] - g) ** 2 + (split(palette[i])[2] - b) ** 2 * 4)
+
+
+def main():
+    w, h, rgb = load_rgb(sys.argv[1])
+    name = sys.argv[2] if len(sys.argv) > 2 else "tilemap"
+    size = int(sys.argv[3]) if len(sys.argv) > 3 else 8
+    if size not in (8, 16) or w % size or h % size:
+        sys.exit("图块边长只能是 8 或 16，图片宽高必须是它的整数倍")
+
+    pixels = [to565(p) for p in rgb]
+    counts = {}
+    for p in pixels:
+        counts[p] = counts.get(p, 0) + 1
+    palette = sorted(counts, key=lambda p: -counts[p])[:16]
+    index = {p: nearest(p, palette) for p in counts}
+    palette += [0] * (16 - len(palette))
+
+    tiles, cells = [], []
+    for ty in range(0, h, size):
+        for tx in range(0, w, size):
+            tile = bytearray()
+            for y in range(ty, ty + size):
+                row = [index[pixels[y * w + x]] for x in range(tx, tx + size)]
+                tile += bytes((row[i] << 4) | row[i + 1] for i in range(0, size, 2))
+            tile = bytes(tile)
+            if tile not in tiles:
+                tiles.append(tile)
+            cells.append(tiles.index(tile))
+    if len(tiles) > 256:
+        sys.exit("图块种类 %d 超过 256" % len(tiles))
+
+    data = b"".join(tiles)
+    print("// %dx%d 图块地图 (%d 种 %dx%d 图块，%d 色)，由 Tools/gen_tilemap.py 生成" % (w, h, len(tiles), size, size, len(counts)))
+    print("const uint8_t %s_tiles[] = {" % name)
+    for i in range(0, len(data), 16):
+        print("    " + ",".join("0x%02X" % b for b in data[i:i + 16]) + ",")
+    print("};")
+    print("const uint16_t %s_palette[16] = {%s};" % (name, ", ".join("0x%04X" % p for p in palette)))
+    print("uint8_t %s_cells[%d * %d] = {" % (name, w // size, h // size))
+    for i in range(0, len(cells), w // size):
+        print("    " + ",".join("%d" % c for c in cells[i:i + w // size]) + ",")
+    print("};")
+    print("// TFT_Tilemap_Init(&map, %s_tiles, %d, %s_palette, %s_cells, %d, %d);" % (name, size, name, name, w // size, h // size))
+    sys.stderr.write("%dx%d: %d tiles, %d + %d bytes (RGB565 %d bytes)\n" % (w, h, len(tiles), len(data), len(cells), w * h * 2))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,37 @@
+/*
+ * PC 端测试程序使用的最小 HAL 声明 (代替 CubeMX 生成的 main.h)
+ */
+#ifndef __HOST_MAIN_H
+#define __HOST_MAIN_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    int unused;
+} GPIO_TypeDef;
+
+typedef struct
+{
+    int unused;
+} DMA_HandleTypeDef;
+
+typedef struct
+{
+    DMA_HandleTypeDef *hdmatx; // 为 NULL 时 TFT_IO_Init 使用阻塞发送
+} SPI_HandleTypeDef;
+
+typedef enum
+{
+    GPIO_PIN_RESET = 0,
+    GPIO_PIN_SET
+} GPIO_PinState;
+
+#define HAL_MAX_DELAY 0xFFFFFFFFU
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state);
+int HAL_SPI_Transmit(SPI_HandleTypeDef *hspi, uint8_t *data, uint16_t size, uint32_t timeout);
+int HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, uint8_t *data, uint16_t size);
+void HAL_Delay(uint32_t ms);
+
+#endif
@@ -0,0 +1,4 @@
+/*
+ * PC 端测试程序使用的 spi.h (代替 CubeMX 生成的 spi.h)
+ */
+#include "main.h"
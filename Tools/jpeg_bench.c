@@ -0,0 +1,160 @@
+/*
+ * JPEG 解码器 PC 端测试和基准程序
+ *
+ * 编译: gcc -O2 -I Core/Inc Tools/jpeg_bench.c Core/Src/TFTc/TFT_jpeg.c -o jpeg_bench
+ * 用法: ./jpeg_bench photo.jpg [重复次数] [输出.ppm]
+ *
+ * 对 1/1、1/2、1/4、1/8 四种缩小比例分别解码若干次，输出平均耗时和每秒解码的像素数:
+ *   memory: 整个文件读入内存后用 TFT_JPEG_Read_Memory 解码 (相当于图片放在 Flash 中)
+ *   file:   通过输入函数每次 fread 一块 (相当于从 SD 卡等文件系统读取)
+ * 给出输出文件名时把 1/1 的解码结果保存为 PPM，可以和其他解码器的结果对比。
+ * PC 上的耗时只用于比较不同图片、比例和改动之间的相对快慢，MCU 上的实际耗时需要在目标板上测量。
+ */
+#include "TFTh/TFT_jpeg.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+static uint8_t *frame;       // 解码结果 (RGB888)，只在保存 PPM 时使用
+static uint16_t frame_width; // 解码结果的宽度
+
+/**
+ * @brief 从文件读取 JPEG 数据的输入函数
+ */
+static uint16_t read_file(void *context, uint8_t *buffer, uint16_t length)
+{
+    return (uint16_t)fread(buffer, 1, length, (FILE *)context);
+}
+
+/**
+ * @brief 输出函数: 只计算校验值，保证解码结果被使用
+ */
+static void output_checksum(void *context, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pixels)
+{
+    uint32_t *sum = (uint32_t *)context;
+
+    for (uint32_t i = 0; i < (uint32_t)width * height * 2; i++)
+        *sum = *sum * 31 + pixels[i];
+    (void)x;
+    (void)y;
+}
+
+/**
+ * @brief 输出函数: 把块写入 frame
+ */
+static void output_frame(void *context, uint16_t x, uint16_t y, uint16_t width, uint16_t height, const uint8_t *pixels)
+{
+    for (uint16_t row = 0; row < height; row++)
+    {
+        for (uint16_t col = 0; col < width; col++)
+        {
+            uint16_t pixel = (uint16_t)(pixels[0] << 8) | pixels[1];
+            uint8_t *dst = frame + ((uint32_t)(y + row) * frame_width + x + col) * 3;
+
+            dst[0] = (uint8_t)((pixel >> 11) << 3);
+            dst[1] = (uint8_t)(((pixel >> 5) & 0x3F) << 2);
+            dst[2] = (uint8_t)((pixel & 0x1F) << 3);
+            pixels += 2;
+        }
+    }
+    (void)context;
+}
+
+static double now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+}
+
+int main(int argc, char **argv)
+{
+    static TFT_JPEG_Decoder dec;
+    const char *names[4] = {"1/1", "1/2", "1/4", "1/8"};
+    int repeat = argc > 2 ? atoi(argv[2]) : 20;
+    FILE *file;
+    uint8_t *data;
+    long size;
+    TFT_JPEG_Memory source;
+    TFT_JPEG_Result result;
+
+    if (argc < 2)
+    {
+        printf("usage: %s photo.jpg [repeat] [out.ppm]\n", argv[0]);
+        return 1;
+    }
+    file = fopen(argv[1], "rb");
+    if (file == NULL)
+    {
+        printf("cannot open %s\n", argv[1]);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    data = (uint8_t *)malloc(size);
+    if (data == NULL || fread(data, 1, size, file) != (size_t)size)
+        return 1;
+
+    source = (TFT_JPEG_Memory){data, (uint32_t)size, 0};
+    result = TFT_JPEG_Prepare(&dec, TFT_JPEG_Read_Memory, &source);
+    if (result != TFT_JPEG_OK)
+    {
+        printf("prepare failed: %d\n", result);
+        return 1;
+    }
+    printf("%s: %ux%u, %u component(s), MCU %ux%u, restart %u, %ld bytes, decoder %u bytes\n", argv[1],
+           dec.width, dec.height, dec.component_count, dec.max_h * 8, dec.max_v * 8, dec.restart_interval, size,
+           (unsigned)sizeof(TFT_JPEG_Decoder));
+
+    for (uint8_t scale = 0; scale < 4; scale++)
+    {
+        uint32_t pixels = ((dec.width + (1u << scale) - 1) >> scale) * ((dec.height + (1u << scale) - 1) >> scale);
+
+        for (int mode = 0; mode < 2; mode++)
+        {
+            uint32_t sum = 0;
+            double start = now_ms(), elapsed;
+
+            for (int i = 0; i < repeat; i++)
+            {
+                if (mode == 0)
+                {
+                    source.pos = 0;
+                    result = TFT_JPEG_Prepare(&dec, TFT_JPEG_Read_Memory, &source);
+                }
+                else
+                {
+                    fseek(file, 0, SEEK_SET);
+                    result = TFT_JPEG_Prepare(&dec, read_file, file);
+                }
+                if (result == TFT_JPEG_OK)
+                    result = TFT_JPEG_Decompress(&dec, scale, output_checksum, &sum);
+            }
+            elapsed = (now_ms() - start) / repeat;
+            printf("%s %-6s: %8.3f ms, %7.2f Mpixel/s, result %d, checksum %08X\n", names[scale],
+                   mode == 0 ? "memory" : "file", elapsed, pixels / elapsed / 1000.0, result, (unsigned)sum);
+        }
+    }
+
+    if (argc > 3)
+    {
+        FILE *out = fopen(argv[3], "wb");
+
+        frame_width = dec.width;
+        frame = (uint8_t *)malloc((size_t)dec.width * dec.height * 3);
+        source.pos = 0;
+        if (out == NULL || frame == NULL)
+            return 1;
+        TFT_JPEG_Prepare(&dec, TFT_JPEG_Read_Memory, &source);
+        TFT_JPEG_Decompress(&dec, 0, output_frame, NULL);
+        fprintf(out, "P6\n%u %u\n255\n", dec.width, dec.height);
+        fwrite(frame, 1, (size_t)dec.width * dec.height * 3, out);
+        fclose(out);
+        free(frame);
+    }
+
+    fclose(file);
+    free(data);
+    return 0;
+}
@@ -0,0 +1,176 @@
+/*
+ * 粗线与多边形覆盖范围 PC 端测试程序
+ *
+ * 编译: gcc -O2 -I Tools/host -I Core/Inc -I Core/Inc/TFTh Tools/line_test.c Core/Src/TFTc/TFT_CAD.c Core/Src/TFTc/TFT_io.c -o line_test
+ * 用法: ./line_test
+ * 加上 -fsanitize=undefined 编译可以同时检查边表中负坐标的运算。
+ *
+ * 用一个只解析 CASET/RASET/RAMWR 的屏幕模拟器接收阻塞式 SPI 数据，检查:
+ *   宽 1 ~ 4 的竖直粗线覆盖的列数、水平粗线覆盖的行数都等于线宽，两者像素数相同;
+ *   10x10 的正方形多边形正好填充 100 个像素，共用一条边的相邻正方形互不覆盖。
+ * 全部通过时返回 0。
+ */
+#include "TFTh/TFT_CAD.h"
+#include "TFTh/TFT_io.h"
+#include <stdio.h>
+#include <string.h>
+
+#define SCREEN_WIDTH 256
+#define SCREEN_HEIGHT 336
+
+static uint16_t screen[SCREEN_HEIGHT][SCREEN_WIDTH];
+static GPIO_TypeDef dc_port, cs_port, res_port, bl_port;
+static SPI_HandleTypeDef hspi;
+static TFT_HandleTypeDef htft;
+
+// 屏幕模拟器状态
+static GPIO_PinState dc_state;
+static uint8_t command, params[4], param_count, high_byte, have_high;
+static uint16_t col_start, col_end, row_start, row_end, col, row;
+
+static void emulate_byte(uint8_t value)
+{
+    if (dc_state == GPIO_PIN_RESET)
+    {
+        command = value;
+        param_count = 0;
+        have_high = 0;
+        col = col_start;
+        row = row_start;
+        return;
+    }
+    if (command == 0x2A || command == 0x2B)
+    {
+        params[param_count++ & 3] = value;
+        if (param_count == 4)
+        {
+            uint16_t start = (uint16_t)(params[0] << 8) | params[1];
+            uint16_t end = (uint16_t)(params[2] << 8) | params[3];
+            if (command == 0x2A)
+                col_start = start, col_end = end;
+            else
+                row_start = start, row_end = end;
+        }
+    }
+    else if (command == 0x2C)
+    {
+        if (!have_high)
+        {
+            high_byte = value;
+            have_high = 1;
+            return;
+        }
+        have_high = 0;
+        if (col < SCREEN_WIDTH && row < SCREEN_HEIGHT)
+            screen[row][col] = (uint16_t)(high_byte << 8) | value;
+        if (++col > col_end)
+        {
+            col = col_start;
+            if (++row > row_end)
+                row = row_start;
+        }
+    }
+}
+
+void HAL_GPIO_WritePin(GPIO_TypeDef *port, uint16_t pin, GPIO_PinState state)
+{
+    (void)pin;
+    if (port == &dc_port)
+        dc_state = state;
+}
+
+int HAL_SPI_Transmit(SPI_HandleTypeDef *spi, uint8_t *data, uint16_t size, uint32_t timeout)
+{
+    (void)spi;
+    (void)timeout;
+    for (uint16_t i = 0; i < size; i++)
+        emulate_byte(data[i]);
+    return 0;
+}
+
+int HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *spi, uint8_t *data, uint16_t size)
+{
+    return HAL_SPI_Transmit(spi, data, size, HAL_MAX_DELAY); // 测试中不启用 DMA
+}
+
+void HAL_Delay(uint32_t ms)
+{
+    (void)ms;
+}
+
+/**
+ * @brief 统计颜色为 color 的像素数以及覆盖的列数、行数
+ */
+static uint32_t coverage(uint16_t color, uint32_t *columns, uint32_t *rows)
+{
+    uint8_t used_columns[SCREEN_WIDTH] = {0};
+    uint8_t used_rows[SCREEN_HEIGHT] = {0};
+    uint32_t pixels = 0;
+
+    *columns = *rows = 0;
+    for (uint16_t y = 0; y < SCREEN_HEIGHT; y++)
+    {
+        for (uint16_t x = 0; x < SCREEN_WIDTH; x++)
+        {
+            if (screen[y][x] != color)
+                continue;
+            pixels++;
+            *columns += !used_columns[x];
+            *rows += !used_rows[y];
+            used_columns[x] = used_rows[y] = 1;
+        }
+    }
+    return pixels;
+}
+
+int main(void)
+{
+    int errors = 0;
+
+    TFT_Init_Instance(&htft, &hspi, &cs_port, 0);
+    TFT_Config_Pins(&htft, &dc_port, 0, &res_port, 0, &bl_port, 0);
+    TFT_IO_Init(&htft);
+
+    for (uint16_t width = 1; width <= 4; width++)
+    {
+        uint32_t v_pixels, v_columns, v_rows, h_pixels, h_columns, h_rows;
+
+        memset(screen, 0, sizeof(screen));
+        TFT_Draw_Thick_Line(&htft, 100, 40, 100, 80, width, TFT_CAP_BUTT, WHITE);
+        v_pixels = coverage(WHITE, &v_columns, &v_rows);
+
+        memset(screen, 0, sizeof(screen));
+        TFT_Draw_Thick_Line(&htft, 40, 200, 80, 200, width, TFT_CAP_BUTT, WHITE);
+        h_pixels = coverage(WHITE, &h_columns, &h_rows);
+
+        printf("width %u: vertical %lu columns x %lu rows, horizontal %lu columns x %lu rows\n", width,
+               (unsigned long)v_columns, (unsigned long)v_rows, (unsigned long)h_columns, (unsigned long)h_rows);
+        if (v_columns != width || h_rows != width || v_pixels != h_pixels || v_rows != h_columns)
+            errors++;
+    }
+
+    // 伸出屏幕左侧、向左倾斜的边 (边表中出现负的 X 坐标和斜率)
+    TFT_Draw_Thick_Line(&htft, 0, 300, 30, 260, 4, TFT_CAP_ROUND, BLUE);
+
+    {
+        const TFT_Point left[4] = {{20, 20}, {30, 20}, {30, 30}, {20, 30}};
+        const TFT_Point right[4] = {{30, 20}, {40, 20}, {40, 30}, {30, 30}};
+        uint32_t pixels, columns, rows;
+
+        memset(screen, 0, sizeof(screen));
+        TFT_Fill_Polygon(&htft, left, 4, RED);
+        pixels = coverage(RED, &columns, &rows);
+        printf("square: %lu pixels, %lu columns x %lu rows\n", (unsigned long)pixels, (unsigned long)columns, (unsigned long)rows);
+        if (pixels != 100 || columns != 10 || rows != 10)
+            errors++;
+
+        TFT_Fill_Polygon(&htft, right, 4, GREEN);
+        pixels = coverage(RED, &columns, &rows);
+        printf("after neighbour: %lu red pixels left\n", (unsigned long)pixels);
+        if (pixels != 100)
+            errors++;
+    }
+
+    printf("%s\n", errors ? "FAILED" : "OK");
+    return errors != 0;
+}